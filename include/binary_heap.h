@@ -8,6 +8,9 @@
 #define BINARY_HEAP_H_
 
 #include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
 
 #include "comparators.h"
 #include "heap_base.h"
@@ -29,6 +32,7 @@ namespace bheap
      *   - Push: O(1 + log n) where log n is the execution time of HeapifyDown
      *   - Pop: O(1 + log n) where log n is the execution time of HeapifyUp
      *   - Peek: O(1)
+     *   - Build from a range: O(n)
      *
      * @tparam typeT The type of elements stored in the binary heap
      * @tparam Compare The custom comparator used to maintain the heap property
@@ -56,6 +60,13 @@ namespace bheap
              **/
             void HeapifyUp(std::size_t index) override;
 
+            /**
+             * @brief Restore the heap property of the whole heap in O(n) with Floyd's
+             * bottom-up method: every internal node is sifted down, from the last
+             * one up to the root
+             **/
+            void Heapify();
+
         public:
             /**
              * @brief Constructor for BinaryHeap
@@ -63,6 +74,17 @@ namespace bheap
              * comparator)
              */
             BinaryHeap(const Compare& comp = Compare());
+
+            /**
+             * @brief Constructor for BinaryHeap that builds the heap from a range of
+             * elements in O(n)
+             * @param first, last The range of elements
+             * @param comp The custom comparator to use (default is the standard
+             * comparator)
+             */
+            template<typename iterator>
+            BinaryHeap(iterator first, iterator last, const Compare& comp = Compare());
+
             ~BinaryHeap();
 
             /**
@@ -71,6 +93,35 @@ namespace bheap
              **/
             void Push(typeT element) override;
 
+            /**
+             * @brief Insert a range of elements into the heap. When the range is at
+             * least as large as the heap, the elements are appended and the whole
+             * heap is rebuilt in O(n). Otherwise each element is sifted up on its
+             * own, which costs less than a rebuild
+             * @param first, last The range of elements
+             **/
+            template<typename iterator>
+            void PushRange(iterator first, iterator last);
+
+            /**
+             * @brief Remove the top element and insert a new one with a single sift,
+             * instead of a Pop followed by a Push
+             * @param element New element
+             * @return The element that was on top
+             * @throw std::underflow_error If heap is empty
+             **/
+            typeT ReplaceTop(typeT element);
+
+            /**
+             * @brief Insert a new element and then remove the top element with a
+             * single sift, instead of a Push followed by a Pop. If the new element
+             * would be the top, the heap is not touched
+             * @param element New element
+             * @return The element with the lowest or highest priority value among the
+             * heap and the new element
+             **/
+            typeT PushPop(typeT element);
+
             /**
              * @brief Get the element with the priority value considered the lowest or
              * highest without removing it
@@ -108,6 +159,16 @@ namespace bheap
         : m_comp(comp)
     { }
 
+    template<typename typeT, typename Compare>
+    template<typename iterator>
+    BinaryHeap<typeT, Compare>::BinaryHeap(iterator       first,
+                                           iterator       last,
+                                           const Compare& comp)
+        : m_comp(comp)
+    {
+        this->PushRange(first, last);
+    }
+
     template<typename typeT, typename Compare>
     BinaryHeap<typeT, Compare>::~BinaryHeap()
     { }
@@ -119,6 +180,49 @@ namespace bheap
         this->HeapifyUp(this->m_heap.Size() - 1);
     }
 
+    template<typename typeT, typename Compare>
+    template<typename iterator>
+    void BinaryHeap<typeT, Compare>::PushRange(iterator first, iterator last)
+    {
+        std::size_t oldSize = this->m_heap.Size();
+
+        if constexpr (std::forward_iterator<iterator>)
+            this->m_heap.Reserve(oldSize + std::distance(first, last));
+
+        for (; first != last; first++)
+            this->m_heap.PushBack(*first);
+
+        std::size_t newSize = this->m_heap.Size();
+
+        if (newSize - oldSize >= oldSize)
+            this->Heapify();
+        else
+            for (std::size_t i = oldSize; i < newSize; i++)
+                this->HeapifyUp(i);
+    }
+
+    template<typename typeT, typename Compare>
+    typeT BinaryHeap<typeT, Compare>::ReplaceTop(typeT element)
+    {
+        if (this->m_heap.IsEmpty())
+            throw std::underflow_error("Heap is empty!");
+
+        typeT toPop     = std::move(this->m_heap[0]);
+        this->m_heap[0] = std::move(element);
+        this->HeapifyDown(0);
+
+        return toPop;
+    }
+
+    template<typename typeT, typename Compare>
+    typeT BinaryHeap<typeT, Compare>::PushPop(typeT element)
+    {
+        if (this->m_heap.IsEmpty() or not this->m_comp(this->m_heap[0], element))
+            return element;
+
+        return this->ReplaceTop(std::move(element));
+    }
+
     template<typename typeT, typename Compare>
     typeT BinaryHeap<typeT, Compare>::Peek()
     {
@@ -157,23 +261,37 @@ namespace bheap
     template<typename typeT, typename Compare>
     void BinaryHeap<typeT, Compare>::HeapifyDown(std::size_t index)
     {
-        std::size_t left    = 2 * index + 1;
-        std::size_t right   = 2 * index + 2;
-        std::size_t largest = index;
+        std::size_t size  = this->m_heap.Size();
+        typeT       value = std::move(this->m_heap[index]);
 
-        if (left < this->m_heap.Size() and
-            this->m_comp(this->m_heap[left], this->m_heap[largest]))
-            largest = left;
+        // The element waits outside the heap while the hole goes down, so each
+        // level costs one move instead of a swap
+        while (2 * index + 1 < size)
+        {
+            std::size_t child = 2 * index + 1;
 
-        if (right < this->m_heap.Size() and
-            this->m_comp(this->m_heap[right], this->m_heap[largest]))
-            largest = right;
+            if (child + 1 < size and
+                this->m_comp(this->m_heap[child + 1], this->m_heap[child]))
+                child++;
 
-        if (largest != index)
-        {
-            this->m_heap.Swap(index, largest);
-            this->HeapifyDown(largest);
+            if (not this->m_comp(this->m_heap[child], value))
+                break;
+
+            this->m_heap[index] = std::move(this->m_heap[child]);
+            index               = child;
         }
+
+        this->m_heap[index] = std::move(value);
+    }
+
+    template<typename typeT, typename Compare>
+    void BinaryHeap<typeT, Compare>::Heapify()
+    {
+        std::size_t size = this->m_heap.Size();
+
+        // Leaves are already heaps, so the last internal node is the first to sift
+        for (std::size_t i = size / 2; i > 0; i--)
+            this->HeapifyDown(i - 1);
     }
 
     template<typename typeT, typename Compare>
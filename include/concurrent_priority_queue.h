@@ -0,0 +1,403 @@
+/*
+ * Filename: concurrent_priority_queue.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef CONCURRENT_PRIORITY_QUEUE_H_
+#define CONCURRENT_PRIORITY_QUEUE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "binary_heap.h"
+#include "comparators.h"
+#include "queue_base.h"
+
+// Binary heap namespace
+namespace bheap
+{
+    /**
+     * @brief Priority queue that many threads can use at once, built as a relaxed
+     * multi-queue
+     *
+     * The queue is split into c * P binary heaps, each behind its own lock, where P
+     * is the number of threads and c a small factor. Enqueue puts the element in a
+     * random heap. Dequeue looks at two random heaps and removes the better of their
+     * tops. Locks are only tried, never waited for: a busy heap is skipped in favor
+     * of another random pick. With several heaps per thread, threads rarely meet on
+     * the same lock and the queue scales with the number of threads
+     *
+     * The price is that Dequeue may not return the best element of the whole queue.
+     * With m = c * P heaps, the rank of the returned element (0 for the best one) is
+     * O(m) in expectation and O(m log m) with high probability, and these bounds do
+     * not grow with the size of the queue. Every element is eventually returned, and
+     * Dequeue only reports an empty queue after checking every heap. Code that needs
+     * the exact order, like tests, can build the queue in strict mode, which uses a
+     * single heap and a blocking lock
+     *
+     * @tparam typeT The type of elements stored in the priority queue
+     * @tparam Compare The custom comparator used to determine the priority of
+     * elements
+     *
+     * NOTE: By default, the 'Compare' parameter is set to 'comparators::Less<typeT>'
+     * for a minimum priority queue
+     */
+    template<typename typeT, typename Compare = decltype(comparators::Less<typeT>)>
+    class ConcurrentPriorityQueue : public QueueBase<typeT>
+    {
+        private:
+            // A heap with its lock, on its own cache lines so that threads working
+            // on neighboring heaps do not slow each other down
+            struct alignas(64) Shard
+            {
+                std::mutex                 mutex;
+                BinaryHeap<typeT, Compare> heap;
+
+                Shard(const Compare& comp)
+                    : heap(comp)
+                { }
+            };
+
+            std::vector<std::unique_ptr<Shard>> m_shards;
+            Compare                             m_comp; // Custom comparator
+            bool                                m_strict;
+
+            // Never below the number of elements in the heaps: it grows before an
+            // element is pushed and shrinks after one is popped
+            std::atomic<std::size_t> m_size;
+
+            /**
+             * @brief Get a random shard index from a per-thread generator
+             */
+            std::size_t RandomShard();
+
+            /**
+             * @brief Pop from the better of two random shards
+             * @param element Receives the popped element
+             * @return True if an element was popped, False if a lock was busy or
+             * both shards were empty
+             */
+            bool TryTwoChoices(typeT& element);
+
+            /**
+             * @brief Pop from the first non-empty shard, waiting for each lock
+             * @param element Receives the popped element
+             * @return True if an element was popped, False if every shard was empty
+             */
+            bool Scan(typeT& element);
+
+        public:
+            /**
+             * @brief Constructor for ConcurrentPriorityQueue
+             * @param threads Number of threads expected to use the queue, or 0 for
+             * the number of hardware threads
+             * @param factor Number of heaps per thread
+             * @param strict If true, keep a single heap so that Dequeue always
+             * returns the best element
+             * @param comp The custom comparator to use (default is the standard
+             * comparator)
+             * @throw std::invalid_argument If factor is zero
+             */
+            ConcurrentPriorityQueue(std::size_t    threads = 0,
+                                    std::size_t    factor  = 2,
+                                    bool           strict  = false,
+                                    const Compare& comp    = Compare());
+
+            ConcurrentPriorityQueue(const ConcurrentPriorityQueue&)            = delete;
+            ConcurrentPriorityQueue& operator=(const ConcurrentPriorityQueue&) = delete;
+
+            ~ConcurrentPriorityQueue();
+
+            /**
+             * @brief Insert a new element into the queue. Safe to call from any
+             * thread
+             * @param element New element
+             **/
+            void Enqueue(typeT element) override;
+
+            /**
+             * @brief Get the best element among the tops of every heap, without
+             * removing it. Under concurrent use, the result may already be stale
+             * @return The element with the lowest or highest priority value
+             * @throw std::overflow_error If queue is empty
+             **/
+            typeT Peek() override;
+
+            /**
+             * @brief Remove and return an element with a priority close to the best
+             * one, see the rank bounds above. Safe to call from any thread
+             * @return The removed element
+             * @throw std::underflow_error If queue is empty
+             **/
+            typeT Dequeue() override;
+
+            /**
+             * @brief Remove an element like Dequeue, without throwing
+             * @param element Receives the removed element
+             * @return True if an element was removed, False if the queue was empty
+             **/
+            bool TryDequeue(typeT& element);
+
+            /**
+             * @brief Check if the queue is empty
+             * @return True if it is empty, False otherwise
+             **/
+            bool IsEmpty() override;
+
+            /**
+             * @brief Get the current size of the queue. Under concurrent use, the
+             * count may include elements that are still being pushed
+             * @return The current size of the queue
+             **/
+            std::size_t Size() override;
+
+            /**
+             * @brief Delete all elements in the queue. Elements pushed while it runs
+             * may be kept
+             **/
+            void Clear() override;
+
+            /**
+             * @return The number of internal heaps
+             **/
+            std::size_t NumHeaps() const;
+    };
+
+    template<typename typeT, typename Compare>
+    ConcurrentPriorityQueue<typeT, Compare>::ConcurrentPriorityQueue(
+        std::size_t    threads,
+        std::size_t    factor,
+        bool           strict,
+        const Compare& comp)
+        : m_comp(comp),
+          m_strict(strict),
+          m_size(0)
+    {
+        if (factor == 0)
+            throw std::invalid_argument("The queue needs at least one heap");
+
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+
+        std::size_t numShards = strict ? 1 : threads * factor;
+
+        for (std::size_t i = 0; i < numShards; i++)
+            this->m_shards.push_back(std::make_unique<Shard>(comp));
+    }
+
+    template<typename typeT, typename Compare>
+    ConcurrentPriorityQueue<typeT, Compare>::~ConcurrentPriorityQueue()
+    { }
+
+    template<typename typeT, typename Compare>
+    void ConcurrentPriorityQueue<typeT, Compare>::Enqueue(typeT element)
+    {
+        this->m_size.fetch_add(1, std::memory_order_relaxed);
+
+        if (this->m_strict)
+        {
+            std::lock_guard<std::mutex> lock(this->m_shards[0]->mutex);
+            this->m_shards[0]->heap.Push(element);
+            return;
+        }
+
+        // A busy heap is skipped. After a round of misses, the thread waits on the
+        // last pick instead of spinning
+        std::size_t numShards = this->m_shards.size();
+        Shard*      shard     = nullptr;
+
+        for (std::size_t attempt = 0; attempt < numShards; attempt++)
+        {
+            shard = this->m_shards[this->RandomShard()].get();
+
+            if (shard->mutex.try_lock())
+            {
+                shard->heap.Push(element);
+                shard->mutex.unlock();
+                return;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->heap.Push(element);
+    }
+
+    template<typename typeT, typename Compare>
+    typeT ConcurrentPriorityQueue<typeT, Compare>::Peek()
+    {
+        bool  found = false;
+        typeT best;
+
+        for (std::unique_ptr<Shard>& shard : this->m_shards)
+        {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+
+            if (shard->heap.IsEmpty())
+                continue;
+
+            typeT top = shard->heap.Peek();
+
+            if (not found or this->m_comp(top, best))
+                best = top;
+
+            found = true;
+        }
+
+        if (not found)
+            throw std::overflow_error("Queue is empty!");
+
+        return best;
+    }
+
+    template<typename typeT, typename Compare>
+    typeT ConcurrentPriorityQueue<typeT, Compare>::Dequeue()
+    {
+        typeT element;
+
+        if (not this->TryDequeue(element))
+            throw std::underflow_error("Queue is empty!");
+
+        return element;
+    }
+
+    template<typename typeT, typename Compare>
+    bool ConcurrentPriorityQueue<typeT, Compare>::TryDequeue(typeT& element)
+    {
+        if (this->m_strict)
+            return this->Scan(element);
+
+        // Random picks miss when locks are busy or the queue is nearly empty. After
+        // a round of misses, the scan settles it. The size is only a hint to skip
+        // the picks: a relaxed load may not see an element that was just enqueued,
+        // so an empty queue is only reported by the scan
+        std::size_t numShards = this->m_shards.size();
+
+        for (std::size_t attempt = 0; attempt < numShards; attempt++)
+        {
+            if (this->m_size.load(std::memory_order_relaxed) == 0)
+                break;
+
+            if (this->TryTwoChoices(element))
+                return true;
+        }
+
+        return this->Scan(element);
+    }
+
+    template<typename typeT, typename Compare>
+    bool ConcurrentPriorityQueue<typeT, Compare>::IsEmpty()
+    {
+        return this->m_size.load(std::memory_order_relaxed) == 0;
+    }
+
+    template<typename typeT, typename Compare>
+    std::size_t ConcurrentPriorityQueue<typeT, Compare>::Size()
+    {
+        return this->m_size.load(std::memory_order_relaxed);
+    }
+
+    template<typename typeT, typename Compare>
+    void ConcurrentPriorityQueue<typeT, Compare>::Clear()
+    {
+        for (std::unique_ptr<Shard>& shard : this->m_shards)
+        {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+
+            this->m_size.fetch_sub(shard->heap.Size(), std::memory_order_relaxed);
+            shard->heap.Clear();
+        }
+    }
+
+    template<typename typeT, typename Compare>
+    std::size_t ConcurrentPriorityQueue<typeT, Compare>::NumHeaps() const
+    {
+        return this->m_shards.size();
+    }
+
+    template<typename typeT, typename Compare>
+    std::size_t ConcurrentPriorityQueue<typeT, Compare>::RandomShard()
+    {
+        // xorshift64, seeded from the address of the state so every thread gets its
+        // own sequence
+        thread_local std::uint64_t state =
+            reinterpret_cast<std::uintptr_t>(&state) * 0x9E3779B97F4A7C15ULL | 1;
+
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        return static_cast<std::size_t>(state % this->m_shards.size());
+    }
+
+    template<typename typeT, typename Compare>
+    bool ConcurrentPriorityQueue<typeT, Compare>::TryTwoChoices(typeT& element)
+    {
+        Shard* a = this->m_shards[this->RandomShard()].get();
+        Shard* b = this->m_shards[this->RandomShard()].get();
+
+        if (not a->mutex.try_lock())
+            return false;
+
+        // try_lock never waits, so taking two locks in any order cannot deadlock
+        if (b != a and not b->mutex.try_lock())
+        {
+            a->mutex.unlock();
+            return false;
+        }
+
+        Shard* chosen = a;
+
+        if (a->heap.IsEmpty() or
+            (not b->heap.IsEmpty() and this->m_comp(b->heap.Peek(), a->heap.Peek())))
+            chosen = b;
+
+        bool popped = not chosen->heap.IsEmpty();
+
+        if (popped)
+            element = chosen->heap.Pop();
+
+        a->mutex.unlock();
+
+        if (b != a)
+            b->mutex.unlock();
+
+        if (popped)
+            this->m_size.fetch_sub(1, std::memory_order_relaxed);
+
+        return popped;
+    }
+
+    template<typename typeT, typename Compare>
+    bool ConcurrentPriorityQueue<typeT, Compare>::Scan(typeT& element)
+    {
+        std::size_t numShards = this->m_shards.size();
+        std::size_t start     = this->m_strict ? 0 : this->RandomShard();
+
+        for (std::size_t i = 0; i < numShards; i++)
+        {
+            Shard* shard = this->m_shards[(start + i) % numShards].get();
+
+            std::lock_guard<std::mutex> lock(shard->mutex);
+
+            if (shard->heap.IsEmpty())
+                continue;
+
+            element = shard->heap.Pop();
+            this->m_size.fetch_sub(1, std::memory_order_relaxed);
+
+            return true;
+        }
+
+        return false;
+    }
+} // namespace bheap
+
+#endif // CONCURRENT_PRIORITY_QUEUE_H_
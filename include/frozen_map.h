@@ -0,0 +1,588 @@
+/*
+ * Filename: frozen_map.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef FROZEN_MAP_H_
+#define FROZEN_MAP_H_
+
+#include <bit>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "comparators.h"
+#include "pair.h"
+
+// Size of a cache line, used to align the key array and to choose how many
+// levels ahead the search prefetches
+#define FROZEN_CACHE_LINE_SIZE 64
+
+namespace rbtree
+{
+    /**
+     * @brief An immutable set stored in Eytzinger (BFS) order
+     *
+     * The keys are kept in a 1-indexed array where the children of position k are
+     * 2k and 2k + 1. The top levels of the implicit tree share a few cache lines,
+     * and the 2^d descendants of a position, d levels below, are contiguous. The
+     * search is branchless and prefetches those descendants while it compares the
+     * current level, so most cache misses overlap with useful work
+     *
+     * Time Complexity:
+     *   Function       Worst case
+     *    build            O(n)
+     *    search         O(log n)
+     *
+     * Space Complexity: O(n)
+     *
+     * @tparam typeK The type of the keys. Must be default constructible
+     * @tparam lessComparator The custom comparator for less-than comparisons
+     * @tparam equalComparator The custom comparator for equal comparisons
+     */
+    template<typename typeK,
+             typename lessComparator  = decltype(comparators::Less<typeK>),
+             typename equalComparator = decltype(comparators::Equal<typeK>)>
+    class FrozenSet
+    {
+        protected:
+            typeK*      m_keys; // Eytzinger array, position 0 is unused
+            std::size_t m_size;
+
+            // Custom comparators
+            lessComparator  m_lessComp;
+            equalComparator m_equalComp;
+
+            // Number of keys that fit in a cache line, rounded down to a power of
+            // two. Position k * PREFETCH_BLOCK is the first descendant of k that is
+            // log2(PREFETCH_BLOCK) levels below it
+            static constexpr std::size_t PREFETCH_BLOCK = std::bit_floor(
+                sizeof(typeK) >= FROZEN_CACHE_LINE_SIZE
+                    ? std::size_t(1)
+                    : std::size_t(FROZEN_CACHE_LINE_SIZE / sizeof(typeK)));
+
+            /**
+             * @brief Allocate a cache line aligned array for 'size' keys
+             * @param size Number of keys
+             * @throw std::bad_alloc If the allocation fails
+             */
+            void Allocate(std::size_t size);
+
+            /**
+             * @brief Destroy the keys and free the array
+             */
+            void Release();
+
+            /**
+             * @brief Get the position of the smallest key
+             * @param size Number of keys
+             * @return The position, or 0 if the set is empty
+             */
+            static std::size_t First(std::size_t size);
+
+            /**
+             * @brief Get the position that follows 'position' in key order
+             * @param position The current position
+             * @param size Number of keys
+             * @return The next position, or 0 after the greatest key
+             */
+            static std::size_t Next(std::size_t position, std::size_t size);
+
+        public:
+            FrozenSet(const lessComparator&  lessComp  = lessComparator(),
+                      const equalComparator& equalComp = equalComparator());
+
+            /**
+             * @brief Build the set from keys produced in ascending order
+             * @param size Number of keys
+             * @param next Callable that returns the next key each time it is called
+             * @throw std::invalid_argument If the keys are not strictly ascending
+             */
+            template<typename Generator>
+            FrozenSet(std::size_t            size,
+                      Generator              next,
+                      const lessComparator&  lessComp  = lessComparator(),
+                      const equalComparator& equalComp = equalComparator());
+
+            FrozenSet(FrozenSet&& other);
+
+            FrozenSet& operator=(FrozenSet&& other);
+
+            FrozenSet(const FrozenSet&)            = delete;
+            FrozenSet& operator=(const FrozenSet&) = delete;
+
+            ~FrozenSet();
+
+            /**
+             * @brief Returns the number of keys in the set
+             * @return Number of keys in the set
+             */
+            std::size_t Size() const;
+
+            /**
+             * @brief Checks if the set is empty
+             * @return True if it's empty, False otherwise
+             */
+            bool IsEmpty() const;
+
+            /**
+             * @brief Find the position of a key in the Eytzinger array
+             * @param key The key used in the search
+             * @return The position in [1, Size()], or 0 if the key was not found
+             */
+            std::size_t Find(const typeK& key) const;
+
+            /**
+             * @brief Checks if a key is in the set
+             * @param key The key used in the search
+             * @return True if the key was found, False otherwise
+             */
+            bool Contains(const typeK& key) const;
+
+            /**
+             * @brief Call a function for each key, in ascending order
+             * @param function Callable that receives a const reference to the key
+             */
+            template<typename Function>
+            void ForEach(Function function) const;
+    };
+
+    /**
+     * @brief An immutable map stored in Eytzinger (BFS) order
+     *
+     * The keys are laid out as in FrozenSet and the values live in a parallel array
+     * indexed by the same positions, so a lookup only touches the value it returns
+     *
+     * @tparam typeK The type of the keys. Must be default constructible
+     * @tparam typeV The type of the values. Must be default constructible
+     * @tparam lessComparator The custom comparator for less-than comparisons
+     * @tparam equalComparator The custom comparator for equal comparisons
+     */
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator  = decltype(comparators::Less<typeK>),
+             typename equalComparator = decltype(comparators::Equal<typeK>)>
+    class FrozenMap : private FrozenSet<typeK, lessComparator, equalComparator>
+    {
+        private:
+            using KeySet = FrozenSet<typeK, lessComparator, equalComparator>;
+
+            typeV* m_values; // Values indexed by the positions of their keys
+
+        public:
+            FrozenMap();
+
+            /**
+             * @brief Build the map from pairs produced in ascending key order
+             * @param size Number of pairs
+             * @param next Callable that returns the next pair each time it is called
+             * @throw std::invalid_argument If the keys are not strictly ascending
+             */
+            template<typename Generator>
+            FrozenMap(std::size_t size, Generator next);
+
+            FrozenMap(FrozenMap&& other);
+
+            FrozenMap& operator=(FrozenMap&& other);
+
+            FrozenMap(const FrozenMap&)            = delete;
+            FrozenMap& operator=(const FrozenMap&) = delete;
+
+            ~FrozenMap();
+
+            using KeySet::Contains;
+            using KeySet::IsEmpty;
+            using KeySet::Size;
+
+            /**
+             * @brief Get the value associated with a key
+             * @param key Key to be looked up
+             * @return The value corresponding to the key
+             * @throw std::out_of_range If the key is not in the map
+             */
+            const typeV& Get(const typeK& key) const;
+
+            /**
+             * @brief Search for the value associated with a key
+             * @param key Key to be looked up
+             * @return Pointer to the value, or nullptr if the key is not in the map
+             */
+            const typeV* Search(const typeK& key) const;
+
+            /**
+             * @brief Call a function for each pair, in ascending key order
+             * @param function Callable that receives const references to the key and
+             * to the value
+             */
+            template<typename Function>
+            void ForEach(Function function) const;
+    };
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    FrozenSet<typeK, lessComparator, equalComparator>::FrozenSet(
+        const lessComparator&  lessComp,
+        const equalComparator& equalComp)
+        : m_keys(nullptr),
+          m_size(0),
+          m_lessComp(lessComp),
+          m_equalComp(equalComp)
+    { }
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    template<typename Generator>
+    FrozenSet<typeK, lessComparator, equalComparator>::FrozenSet(
+        std::size_t            size,
+        Generator              next,
+        const lessComparator&  lessComp,
+        const equalComparator& equalComp)
+        : m_keys(nullptr),
+          m_size(0),
+          m_lessComp(lessComp),
+          m_equalComp(equalComp)
+    {
+        this->Allocate(size);
+
+        // Visiting the positions in key order places the sorted input directly
+        std::size_t previous = 0;
+
+        try
+        {
+            for (std::size_t k = First(size); k != 0; k = Next(k, size))
+            {
+                this->m_keys[k] = next();
+
+                if (previous != 0 and
+                    not this->m_lessComp(this->m_keys[previous], this->m_keys[k]))
+                    throw std::invalid_argument(
+                        "Keys are not in strictly ascending order");
+
+                previous = k;
+            }
+        }
+        catch (...)
+        {
+            // The destructor does not run when a constructor throws
+            this->Release();
+            throw;
+        }
+    }
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    FrozenSet<typeK, lessComparator, equalComparator>::FrozenSet(FrozenSet&& other)
+        : m_keys(other.m_keys),
+          m_size(other.m_size),
+          m_lessComp(other.m_lessComp),
+          m_equalComp(other.m_equalComp)
+    {
+        other.m_keys = nullptr;
+        other.m_size = 0;
+    }
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    FrozenSet<typeK, lessComparator, equalComparator>&
+    FrozenSet<typeK, lessComparator, equalComparator>::operator=(FrozenSet&& other)
+    {
+        if (this == &other)
+            return *this;
+
+        this->Release();
+
+        this->m_keys      = other.m_keys;
+        this->m_size      = other.m_size;
+        this->m_lessComp  = std::move(other.m_lessComp);
+        this->m_equalComp = std::move(other.m_equalComp);
+
+        other.m_keys = nullptr;
+        other.m_size = 0;
+
+        return *this;
+    }
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    FrozenSet<typeK, lessComparator, equalComparator>::~FrozenSet()
+    {
+        this->Release();
+    }
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    void FrozenSet<typeK, lessComparator, equalComparator>::Allocate(std::size_t size)
+    {
+        if (size == 0)
+            return;
+
+        // std::aligned_alloc requires a size multiple of the alignment
+        std::size_t bytes = (size + 1) * sizeof(typeK);
+        bytes = (bytes + FROZEN_CACHE_LINE_SIZE - 1) / FROZEN_CACHE_LINE_SIZE *
+                FROZEN_CACHE_LINE_SIZE;
+
+        void* memory = std::aligned_alloc(FROZEN_CACHE_LINE_SIZE, bytes);
+
+        if (memory == nullptr)
+            throw std::bad_alloc();
+
+        this->m_keys = static_cast<typeK*>(memory);
+
+        std::size_t i = 0;
+
+        try
+        {
+            for (; i <= size; i++)
+                new (&this->m_keys[i]) typeK();
+        }
+        catch (...)
+        {
+            std::destroy_n(this->m_keys, i);
+            std::free(memory);
+            this->m_keys = nullptr;
+            throw;
+        }
+
+        this->m_size = size;
+    }
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    void FrozenSet<typeK, lessComparator, equalComparator>::Release()
+    {
+        if (this->m_keys == nullptr)
+            return;
+
+        for (std::size_t i = 0; i <= this->m_size; i++)
+            this->m_keys[i].~typeK();
+
+        std::free(this->m_keys);
+
+        this->m_keys = nullptr;
+        this->m_size = 0;
+    }
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    std::size_t
+    FrozenSet<typeK, lessComparator, equalComparator>::First(std::size_t size)
+    {
+        if (size == 0)
+            return 0;
+
+        std::size_t position = 1;
+
+        while (2 * position <= size)
+            position *= 2;
+
+        return position;
+    }
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    std::size_t
+    FrozenSet<typeK, lessComparator, equalComparator>::Next(std::size_t position,
+                                                            std::size_t size)
+    {
+        // Leftmost position of the right subtree, if there is one
+        if (2 * position + 1 <= size)
+        {
+            position = 2 * position + 1;
+
+            while (2 * position <= size)
+                position *= 2;
+
+            return position;
+        }
+
+        // Otherwise climb while coming from a right child, then once more
+        return position >> (std::countr_one(position) + 1);
+    }
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    std::size_t FrozenSet<typeK, lessComparator, equalComparator>::Size() const
+    {
+        return this->m_size;
+    }
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    bool FrozenSet<typeK, lessComparator, equalComparator>::IsEmpty() const
+    {
+        return this->m_size == 0;
+    }
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    std::size_t
+    FrozenSet<typeK, lessComparator, equalComparator>::Find(const typeK& key) const
+    {
+        std::size_t position = 1;
+
+        while (position <= this->m_size)
+        {
+            // The address may be past the end of the array. Prefetching it is
+            // harmless, since prefetches never fault
+            __builtin_prefetch(this->m_keys + position * PREFETCH_BLOCK);
+
+            position = 2 * position + this->m_lessComp(this->m_keys[position], key);
+        }
+
+        // Undo the right turns taken after the last left turn. The remaining
+        // position holds the smallest key not less than 'key'
+        position >>= std::countr_one(position) + 1;
+
+        if (position == 0 or not this->m_equalComp(this->m_keys[position], key))
+            return 0;
+
+        return position;
+    }
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    bool FrozenSet<typeK, lessComparator, equalComparator>::Contains(
+        const typeK& key) const
+    {
+        return this->Find(key) != 0;
+    }
+
+    template<typename typeK, typename lessComparator, typename equalComparator>
+    template<typename Function>
+    void FrozenSet<typeK, lessComparator, equalComparator>::ForEach(
+        Function function) const
+    {
+        for (std::size_t k = First(this->m_size); k != 0; k = Next(k, this->m_size))
+            function(static_cast<const typeK&>(this->m_keys[k]));
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    FrozenMap<typeK, typeV, lessComparator, equalComparator>::FrozenMap()
+        : KeySet(),
+          m_values(nullptr)
+    { }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    template<typename Generator>
+    FrozenMap<typeK, typeV, lessComparator, equalComparator>::FrozenMap(
+        std::size_t size,
+        Generator   next)
+        : KeySet(),
+          m_values(nullptr)
+    {
+        if (size == 0)
+            return;
+
+        this->m_values = new typeV[size + 1];
+
+        // The key set calls the generator in key order, so the position of the key
+        // it is storing is known here and the value goes to the same position
+        std::size_t position = 0;
+
+        try
+        {
+            KeySet keys(size, [&]() -> typeK {
+                const Pair<typeK, typeV>& pair = next();
+
+                position                 = position == 0 ? KeySet::First(size)
+                                                         : KeySet::Next(position, size);
+                this->m_values[position] = pair.GetSecond();
+
+                return pair.GetFirst();
+            });
+
+            KeySet::operator=(std::move(keys));
+        }
+        catch (...)
+        {
+            delete[] this->m_values;
+            this->m_values = nullptr;
+            throw;
+        }
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    FrozenMap<typeK, typeV, lessComparator, equalComparator>::FrozenMap(
+        FrozenMap&& other)
+        : KeySet(std::move(other)),
+          m_values(other.m_values)
+    {
+        other.m_values = nullptr;
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    FrozenMap<typeK, typeV, lessComparator, equalComparator>&
+    FrozenMap<typeK, typeV, lessComparator, equalComparator>::operator=(
+        FrozenMap&& other)
+    {
+        if (this == &other)
+            return *this;
+
+        KeySet::operator=(std::move(other));
+
+        delete[] this->m_values;
+        this->m_values = other.m_values;
+        other.m_values = nullptr;
+
+        return *this;
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    FrozenMap<typeK, typeV, lessComparator, equalComparator>::~FrozenMap()
+    {
+        delete[] this->m_values;
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    const typeV& FrozenMap<typeK, typeV, lessComparator, equalComparator>::Get(
+        const typeK& key) const
+    {
+        std::size_t position = KeySet::Find(key);
+
+        if (position == 0)
+            throw std::out_of_range("Key not found in the map");
+
+        return this->m_values[position];
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    const typeV* FrozenMap<typeK, typeV, lessComparator, equalComparator>::Search(
+        const typeK& key) const
+    {
+        std::size_t position = KeySet::Find(key);
+
+        return position == 0 ? nullptr : &this->m_values[position];
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    template<typename Function>
+    void FrozenMap<typeK, typeV, lessComparator, equalComparator>::ForEach(
+        Function function) const
+    {
+        std::size_t size = this->m_size;
+
+        for (std::size_t k = KeySet::First(size); k != 0; k = KeySet::Next(k, size))
+        {
+            function(static_cast<const typeK&>(this->m_keys[k]),
+                     static_cast<const typeV&>(this->m_values[k]));
+        }
+    }
+
+} // namespace rbtree
+
+#endif // FROZEN_MAP_H_
@@ -0,0 +1,474 @@
+/*
+ * Filename: indexed_priority_queue.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef INDEXED_PRIORITY_QUEUE_H_
+#define INDEXED_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "comparators.h"
+#include "queue_base.h"
+#include "vector.h"
+
+// Binary heap namespace
+namespace bheap
+{
+    /**
+     * @brief Implementation of a priority queue whose elements can be changed or
+     * removed after they are enqueued
+     *
+     * Every element gets a handle when it is pushed. The heap stores handles, and a
+     * position map tells where each handle is in the heap, so an element can be
+     * found in O(1) and moved to its new place in O(log n). A handle stays valid,
+     * whatever happens to the other elements, until its element leaves the queue.
+     * Its slot may then be given to a new element, but the handle carries a
+     * generation number, so the old handle is still recognized as stale
+     *
+     * Worst-case time complexities:
+     *   - Push/Enqueue: O(log n)
+     *   - Dequeue: O(log n)
+     *   - DecreaseKey, IncreaseKey, Update, Remove: O(log n)
+     *   - Peek, Get, Contains: O(1)
+     *
+     * @tparam typeT The type of elements stored in the priority queue
+     * @tparam Compare The custom comparator used to determine the priority of
+     * elements
+     *
+     * NOTE: By default, the 'Compare' parameter is set to 'comparators::Less<typeT>'
+     * for a minimum priority queue. With it, DecreaseKey moves an element towards the
+     * front of the queue
+     */
+    template<typename typeT, typename Compare = decltype(comparators::Less<typeT>)>
+    class IndexedPriorityQueue : public QueueBase<typeT>
+    {
+        public:
+            // Slot in the low 32 bits, generation in the high 32 bits
+            using Handle = std::uint64_t;
+
+        private:
+            // Position of a slot that is not in the heap
+            static constexpr std::size_t NOT_QUEUED =
+                std::numeric_limits<std::size_t>::max();
+
+            Vector<std::uint32_t> m_heap;       // Slots, in heap order
+            Vector<typeT>         m_values;     // Element of each slot
+            Vector<std::size_t>   m_position;   // Heap position of each slot
+            Vector<std::uint32_t> m_generation; // Bumped each time a slot is freed
+            Vector<std::uint32_t> m_free;       // Slots ready to be reused
+            Compare               m_comp;       // Custom comparator
+
+            /**
+             * @brief Move the slot at 'index' up until its parent precedes it
+             * @param index Position in the heap
+             **/
+            void HeapifyUp(std::size_t index);
+
+            /**
+             * @brief Move the slot at 'index' down until no child precedes it
+             * @param index Position in the heap
+             **/
+            void HeapifyDown(std::size_t index);
+
+            /**
+             * @brief Take a slot out of the heap and free it, which makes its
+             * handle stale
+             * @param index Position of the slot in the heap
+             **/
+            void RemoveAt(std::size_t index);
+
+            /**
+             * @brief Build the handle of the element in a slot
+             **/
+            Handle MakeHandle(std::uint32_t slot) const;
+
+            /**
+             * @brief Get the slot of a handle that belongs to an element in the queue
+             * @throw std::out_of_range If it does not
+             **/
+            std::uint32_t CheckHandle(Handle handle) const;
+
+        public:
+            /**
+             * @brief Constructor for IndexedPriorityQueue
+             * @param comp The custom comparator to use (default is the standard
+             * comparator)
+             */
+            IndexedPriorityQueue(const Compare& comp = Compare());
+
+            ~IndexedPriorityQueue();
+
+            /**
+             * @brief Insert a new element into the queue
+             * @param element New element
+             * @return The handle of the element
+             **/
+            Handle Push(typeT element);
+
+            /**
+             * @brief Insert a new element into the queue, discarding its handle
+             * @param element New element
+             **/
+            void Enqueue(typeT element) override;
+
+            /**
+             * @brief Get the element with the priority value considered the lowest or
+             * highest without removing it
+             * @return The element with the lowest or highest priority value
+             * @throw std::overflow_error If queue is empty
+             **/
+            typeT Peek() override;
+
+            /**
+             * @brief Get the handle of the element returned by Peek
+             * @return The handle of the element with the lowest or highest priority
+             * value
+             * @throw std::overflow_error If queue is empty
+             **/
+            Handle PeekHandle();
+
+            /**
+             * @brief Remove and return the element with the priority value considered
+             * the lowest or highest. Its handle becomes invalid
+             * @return The element with the lowest or highest priority value
+             * @throw std::underflow_error If queue is empty
+             **/
+            typeT Dequeue() override;
+
+            /**
+             * @brief Check if a handle belongs to an element in the queue
+             * @return True if it does, False otherwise, also for the handle of an
+             * element that left the queue and whose slot was reused
+             **/
+            bool Contains(Handle handle) const;
+
+            /**
+             * @brief Get the element of a handle
+             * @throw std::out_of_range If the handle is not in the queue
+             **/
+            const typeT& Get(Handle handle) const;
+
+            /**
+             * @brief Give an element a value that does not come after its current
+             * one, moving it towards the front of the queue
+             * @throw std::out_of_range If the handle is not in the queue
+             * @throw std::invalid_argument If the new value comes after the current
+             * one
+             **/
+            void DecreaseKey(Handle handle, typeT element);
+
+            /**
+             * @brief Give an element a value that does not come before its current
+             * one, moving it towards the back of the queue
+             * @throw std::out_of_range If the handle is not in the queue
+             * @throw std::invalid_argument If the new value comes before the current
+             * one
+             **/
+            void IncreaseKey(Handle handle, typeT element);
+
+            /**
+             * @brief Give an element any new value
+             * @throw std::out_of_range If the handle is not in the queue
+             **/
+            void Update(Handle handle, typeT element);
+
+            /**
+             * @brief Remove an element from the queue. Its handle becomes invalid
+             * @return The removed element
+             * @throw std::out_of_range If the handle is not in the queue
+             **/
+            typeT Remove(Handle handle);
+
+            /**
+             * @brief Check if the queue is empty
+             * @return True if it is empty, False otherwise
+             **/
+            bool IsEmpty() override;
+
+            /**
+             * @brief Get the current size of the queue
+             * @return The current size of the queue
+             **/
+            std::size_t Size() override;
+
+            /**
+             * @brief Delete all elements in the queue. Every handle becomes invalid
+             **/
+            void Clear() override;
+    };
+
+    template<typename typeT, typename Compare>
+    IndexedPriorityQueue<typeT, Compare>::IndexedPriorityQueue(const Compare& comp)
+        : m_comp(comp)
+    { }
+
+    template<typename typeT, typename Compare>
+    IndexedPriorityQueue<typeT, Compare>::~IndexedPriorityQueue()
+    { }
+
+    template<typename typeT, typename Compare>
+    typename IndexedPriorityQueue<typeT, Compare>::Handle
+    IndexedPriorityQueue<typeT, Compare>::Push(typeT element)
+    {
+        std::uint32_t slot;
+
+        if (this->m_free.IsEmpty())
+        {
+            slot = static_cast<std::uint32_t>(this->m_values.Size());
+            this->m_values.PushBack(std::move(element));
+            this->m_position.PushBack(NOT_QUEUED);
+            this->m_generation.PushBack(0);
+        }
+        else
+        {
+            slot = this->m_free.Back();
+            this->m_free.PopBack();
+            this->m_values[slot] = std::move(element);
+        }
+
+        this->m_position[slot] = this->m_heap.Size();
+        this->m_heap.PushBack(slot);
+        this->HeapifyUp(this->m_heap.Size() - 1);
+
+        return this->MakeHandle(slot);
+    }
+
+    template<typename typeT, typename Compare>
+    void IndexedPriorityQueue<typeT, Compare>::Enqueue(typeT element)
+    {
+        this->Push(std::move(element));
+    }
+
+    template<typename typeT, typename Compare>
+    typeT IndexedPriorityQueue<typeT, Compare>::Peek()
+    {
+        if (this->m_heap.IsEmpty())
+            throw std::overflow_error("Queue is empty!");
+
+        return this->m_values[this->m_heap[0]];
+    }
+
+    template<typename typeT, typename Compare>
+    typename IndexedPriorityQueue<typeT, Compare>::Handle
+    IndexedPriorityQueue<typeT, Compare>::PeekHandle()
+    {
+        if (this->m_heap.IsEmpty())
+            throw std::overflow_error("Queue is empty!");
+
+        return this->MakeHandle(this->m_heap[0]);
+    }
+
+    template<typename typeT, typename Compare>
+    typeT IndexedPriorityQueue<typeT, Compare>::Dequeue()
+    {
+        if (this->m_heap.IsEmpty())
+            throw std::underflow_error("Queue is empty!");
+
+        typeT toPop = std::move(this->m_values[this->m_heap[0]]);
+        this->RemoveAt(0);
+
+        return toPop;
+    }
+
+    template<typename typeT, typename Compare>
+    bool IndexedPriorityQueue<typeT, Compare>::Contains(Handle handle) const
+    {
+        std::uint32_t slot       = static_cast<std::uint32_t>(handle);
+        std::uint32_t generation = static_cast<std::uint32_t>(handle >> 32);
+
+        return slot < this->m_position.Size() and
+               this->m_generation[slot] == generation and
+               this->m_position[slot] != NOT_QUEUED;
+    }
+
+    template<typename typeT, typename Compare>
+    const typeT& IndexedPriorityQueue<typeT, Compare>::Get(Handle handle) const
+    {
+        return this->m_values[this->CheckHandle(handle)];
+    }
+
+    template<typename typeT, typename Compare>
+    void IndexedPriorityQueue<typeT, Compare>::DecreaseKey(Handle handle,
+                                                           typeT  element)
+    {
+        std::uint32_t slot = this->CheckHandle(handle);
+
+        if (this->m_comp(this->m_values[slot], element))
+            throw std::invalid_argument("New key comes after the current one");
+
+        this->m_values[slot] = std::move(element);
+        this->HeapifyUp(this->m_position[slot]);
+    }
+
+    template<typename typeT, typename Compare>
+    void IndexedPriorityQueue<typeT, Compare>::IncreaseKey(Handle handle,
+                                                           typeT  element)
+    {
+        std::uint32_t slot = this->CheckHandle(handle);
+
+        if (this->m_comp(element, this->m_values[slot]))
+            throw std::invalid_argument("New key comes before the current one");
+
+        this->m_values[slot] = std::move(element);
+        this->HeapifyDown(this->m_position[slot]);
+    }
+
+    template<typename typeT, typename Compare>
+    void IndexedPriorityQueue<typeT, Compare>::Update(Handle handle, typeT element)
+    {
+        std::uint32_t slot = this->CheckHandle(handle);
+
+        bool up = this->m_comp(element, this->m_values[slot]);
+
+        this->m_values[slot] = std::move(element);
+
+        if (up)
+            this->HeapifyUp(this->m_position[slot]);
+        else
+            this->HeapifyDown(this->m_position[slot]);
+    }
+
+    template<typename typeT, typename Compare>
+    typeT IndexedPriorityQueue<typeT, Compare>::Remove(Handle handle)
+    {
+        std::uint32_t slot = this->CheckHandle(handle);
+
+        typeT removed = std::move(this->m_values[slot]);
+        this->RemoveAt(this->m_position[slot]);
+
+        return removed;
+    }
+
+    template<typename typeT, typename Compare>
+    bool IndexedPriorityQueue<typeT, Compare>::IsEmpty()
+    {
+        return this->m_heap.IsEmpty();
+    }
+
+    template<typename typeT, typename Compare>
+    std::size_t IndexedPriorityQueue<typeT, Compare>::Size()
+    {
+        return this->m_heap.Size();
+    }
+
+    template<typename typeT, typename Compare>
+    void IndexedPriorityQueue<typeT, Compare>::Clear()
+    {
+        // The slots are kept, so that their generations keep the old handles stale
+        for (std::size_t index = 0; index < this->m_heap.Size(); index++)
+        {
+            std::uint32_t slot = this->m_heap[index];
+
+            this->m_values[slot]   = typeT();
+            this->m_position[slot] = NOT_QUEUED;
+            this->m_generation[slot]++;
+            this->m_free.PushBack(slot);
+        }
+
+        this->m_heap.Clear();
+    }
+
+    template<typename typeT, typename Compare>
+    void IndexedPriorityQueue<typeT, Compare>::RemoveAt(std::size_t index)
+    {
+        std::uint32_t slot = this->m_heap[index];
+        std::size_t   last = this->m_heap.Size() - 1;
+
+        this->m_position[slot] = NOT_QUEUED;
+        this->m_generation[slot]++;
+        this->m_free.PushBack(slot);
+
+        if (index == last)
+        {
+            this->m_heap.PopBack();
+            return;
+        }
+
+        // The last slot fills the gap and may have to go either way from there
+        std::uint32_t moved     = this->m_heap[last];
+        this->m_heap[index]     = moved;
+        this->m_position[moved] = index;
+        this->m_heap.PopBack();
+
+        if (index > 0 and
+            this->m_comp(this->m_values[moved],
+                         this->m_values[this->m_heap[(index - 1) / 2]]))
+            this->HeapifyUp(index);
+        else
+            this->HeapifyDown(index);
+    }
+
+    template<typename typeT, typename Compare>
+    typename IndexedPriorityQueue<typeT, Compare>::Handle
+    IndexedPriorityQueue<typeT, Compare>::MakeHandle(std::uint32_t slot) const
+    {
+        return (static_cast<Handle>(this->m_generation[slot]) << 32) | slot;
+    }
+
+    template<typename typeT, typename Compare>
+    std::uint32_t IndexedPriorityQueue<typeT, Compare>::CheckHandle(Handle handle) const
+    {
+        if (not this->Contains(handle))
+            throw std::out_of_range("Handle is not in the queue!");
+
+        return static_cast<std::uint32_t>(handle);
+    }
+
+    template<typename typeT, typename Compare>
+    void IndexedPriorityQueue<typeT, Compare>::HeapifyUp(std::size_t index)
+    {
+        std::uint32_t slot  = this->m_heap[index];
+        const typeT&  value = this->m_values[slot];
+
+        while (index > 0)
+        {
+            std::size_t parent = (index - 1) / 2;
+
+            if (not this->m_comp(value, this->m_values[this->m_heap[parent]]))
+                break;
+
+            this->m_heap[index]                   = this->m_heap[parent];
+            this->m_position[this->m_heap[index]] = index;
+            index                                 = parent;
+        }
+
+        this->m_heap[index]    = slot;
+        this->m_position[slot] = index;
+    }
+
+    template<typename typeT, typename Compare>
+    void IndexedPriorityQueue<typeT, Compare>::HeapifyDown(std::size_t index)
+    {
+        std::size_t   size  = this->m_heap.Size();
+        std::uint32_t slot  = this->m_heap[index];
+        const typeT&  value = this->m_values[slot];
+
+        while (2 * index + 1 < size)
+        {
+            std::size_t child = 2 * index + 1;
+
+            if (child + 1 < size and
+                this->m_comp(this->m_values[this->m_heap[child + 1]],
+                             this->m_values[this->m_heap[child]]))
+                child++;
+
+            if (not this->m_comp(this->m_values[this->m_heap[child]], value))
+                break;
+
+            this->m_heap[index]                   = this->m_heap[child];
+            this->m_position[this->m_heap[index]] = index;
+            index                                 = child;
+        }
+
+        this->m_heap[index]    = slot;
+        this->m_position[slot] = index;
+    }
+} // namespace bheap
+
+#endif // INDEXED_PRIORITY_QUEUE_H_
@@ -0,0 +1,324 @@
+/*
+ * Filename: interval_tree.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef INTERVAL_TREE_H_
+#define INTERVAL_TREE_H_
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+#include "node_rbtree.h"
+#include "red_black_tree.h"
+
+namespace rbtree
+{
+    /**
+     * @brief A closed interval [low, high] with a payload, as stored by the
+     * IntervalTree. 'maxHigh' is the greatest endpoint of the subtree rooted at the
+     * interval and is maintained by the tree
+     */
+    template<typename typeT, typename payload>
+    struct Interval
+    {
+        typeT   low;
+        typeT   high;
+        payload value;
+        typeT   maxHigh;
+
+        Interval() = default;
+
+        Interval(const typeT& low, const typeT& high, const payload& value)
+            : low(low),
+              high(high),
+              value(value),
+              maxHigh(high)
+        { }
+
+        /**
+         * @brief Recompute the greatest endpoint of the subtree from the children
+         * @param left The interval of the left child, or nullptr
+         * @param right The interval of the right child, or nullptr
+         */
+        void Augment(const Interval* left, const Interval* right)
+        {
+            this->maxHigh = this->high;
+
+            if (left != nullptr and this->maxHigh < left->maxHigh)
+                this->maxHigh = left->maxHigh;
+
+            if (right != nullptr and this->maxHigh < right->maxHigh)
+                this->maxHigh = right->maxHigh;
+        }
+    };
+
+    /**
+     * @brief Orders intervals by their low endpoint, then by their high endpoint
+     */
+    template<typename typeT, typename payload>
+    auto IntervalLess = [](const Interval<typeT, payload>& a,
+                           const Interval<typeT, payload>& b) -> bool {
+        return a.low < b.low or (not(b.low < a.low) and a.high < b.high);
+    };
+
+    /**
+     * @brief Considers two intervals equal if they have the same endpoints
+     */
+    template<typename typeT, typename payload>
+    auto IntervalEqual = [](const Interval<typeT, payload>& a,
+                            const Interval<typeT, payload>& b) -> bool {
+        return a.low == b.low and a.high == b.high;
+    };
+
+    /**
+     * @brief An interval tree: a Red-Black Tree of intervals ordered by their low
+     * endpoint, where each node also knows the greatest high endpoint of its subtree
+     *
+     * That augmentation is kept up to date by the insertion, removal and rotation
+     * code of RedBlackTree, and lets the overlap queries skip every subtree that
+     * ends before the query. A subtree whose maxHigh reaches the query may still
+     * hold no overlapping interval, so a query can walk O(log n) nodes for each
+     * interval it reports. A centered interval tree answers in O(log n + k), but
+     * could not reuse the Red-Black Tree
+     *
+     * Time Complexity:
+     *   Function       Worst case
+     *    insert         O(log n)
+     *    remove         O(log n)
+     *    overlapping    O(min(n, k log n)), for k >= 1 reported intervals
+     *    build          O(n)
+     *
+     * Space Complexity: O(n)
+     *
+     * @tparam typeT The type of the endpoints
+     * @tparam payload The type of the value attached to each interval
+     */
+    template<typename typeT, typename payload>
+    class IntervalTree
+        : private RedBlackTree<Interval<typeT, payload>,
+                               decltype(IntervalLess<typeT, payload>),
+                               decltype(IntervalEqual<typeT, payload>)>
+    {
+        private:
+            using RBTree = RedBlackTree<Interval<typeT, payload>,
+                                        decltype(IntervalLess<typeT, payload>),
+                                        decltype(IntervalEqual<typeT, payload>)>;
+
+            using NodeType = Node<Interval<typeT, payload>>;
+
+            /**
+             * @brief Report the intervals of a subtree that overlap [low, high]
+             * (recursive call)
+             * @param node The root of the subtree
+             * @param f Function called for each overlapping interval
+             */
+            template<typename function>
+            void Overlapping(NodeType*    node,
+                             const typeT& low,
+                             const typeT& high,
+                             function&    f);
+
+            /**
+             * @brief Check the greatest endpoint stored at every node of a subtree
+             * (recursive call)
+             * @param node The root of the subtree
+             * @throw std::logic_error If a node holds a stale endpoint
+             */
+            void ValidateMaxHigh(NodeType* node) const;
+
+        public:
+            IntervalTree();
+
+            /**
+             * @brief Insert an interval. Several intervals may have the same
+             * endpoints
+             * @param low, high The endpoints of the closed interval
+             * @param value The payload of the interval
+             * @throw std::invalid_argument If high < low
+             */
+            void Insert(const typeT& low, const typeT& high, const payload& value);
+
+            /**
+             * @brief Replace the contents of the tree in O(n)
+             * @param intervals Intervals sorted by low and then high endpoint
+             * @throw std::invalid_argument If the intervals are not sorted or one of
+             * them has high < low
+             */
+            void Build(std::span<const Interval<typeT, payload>> intervals);
+
+            /**
+             * @brief Remove one interval with the given endpoints
+             * @return True if an interval was removed, False if none was found
+             */
+            bool Remove(const typeT& low, const typeT& high);
+
+            /**
+             * @brief Call a function for each interval that overlaps [low, high], in
+             * ascending order of low endpoint, in O(min(n, k log n)) for k reported
+             * intervals (O(log n) when there are none)
+             * @param f Function called as f(low, high, value)
+             */
+            template<typename function>
+            void Overlapping(const typeT& low, const typeT& high, function f);
+
+            /**
+             * @brief Call a function for each interval that contains a point
+             * @param f Function called as f(low, high, value)
+             */
+            template<typename function>
+            void Stabbing(const typeT& point, function f);
+
+            /**
+             * @return The number of intervals
+             */
+            std::size_t Size() const;
+
+            /**
+             * @return True if it's empty, False otherwise
+             */
+            bool IsEmpty();
+
+            /**
+             * @brief Remove every interval
+             */
+            void Clear();
+
+            /**
+             * @brief Check the invariants of the underlying tree and the greatest
+             * endpoint stored at every node, in O(n)
+             * @throw std::logic_error Describing the first violation found
+             */
+            void Validate() const;
+    };
+
+    template<typename typeT, typename payload>
+    IntervalTree<typeT, payload>::IntervalTree()
+        : RBTree()
+    { }
+
+    template<typename typeT, typename payload>
+    void IntervalTree<typeT, payload>::Insert(const typeT&   low,
+                                              const typeT&   high,
+                                              const payload& value)
+    {
+        if (high < low)
+            throw std::invalid_argument("Interval ends before it starts");
+
+        RBTree::InsertMulti(Interval<typeT, payload>(low, high, value));
+    }
+
+    template<typename typeT, typename payload>
+    void IntervalTree<typeT, payload>::Build(
+        std::span<const Interval<typeT, payload>> intervals)
+    {
+        for (const Interval<typeT, payload>& interval : intervals)
+            if (interval.high < interval.low)
+                throw std::invalid_argument("Interval ends before it starts");
+
+        RBTree::BuildSorted(intervals);
+    }
+
+    template<typename typeT, typename payload>
+    bool IntervalTree<typeT, payload>::Remove(const typeT& low, const typeT& high)
+    {
+        NodeType* node = RBTree::Search(Interval<typeT, payload>(low, high, payload()));
+
+        if (node == nullptr)
+            return false;
+
+        RBTree::DeleteNode(node);
+        return true;
+    }
+
+    template<typename typeT, typename payload>
+    template<typename function>
+    void IntervalTree<typeT, payload>::Overlapping(NodeType*    node,
+                                                   const typeT& low,
+                                                   const typeT& high,
+                                                   function&    f)
+    {
+        // Nothing in this subtree reaches the query
+        if (node == nullptr or node->GetValue().maxHigh < low)
+            return;
+
+        this->Overlapping(node->GetLeftNode(), low, high, f);
+
+        Interval<typeT, payload>& interval = node->GetValue();
+
+        // This node and its right subtree start after the query
+        if (high < interval.low)
+            return;
+
+        if (not(interval.high < low))
+            f(interval.low, interval.high, interval.value);
+
+        this->Overlapping(node->GetRightNode(), low, high, f);
+    }
+
+    template<typename typeT, typename payload>
+    template<typename function>
+    void IntervalTree<typeT, payload>::Overlapping(const typeT& low,
+                                                   const typeT& high,
+                                                   function     f)
+    {
+        this->Overlapping(this->m_root, low, high, f);
+    }
+
+    template<typename typeT, typename payload>
+    template<typename function>
+    void IntervalTree<typeT, payload>::Stabbing(const typeT& point, function f)
+    {
+        this->Overlapping(this->m_root, point, point, f);
+    }
+
+    template<typename typeT, typename payload>
+    std::size_t IntervalTree<typeT, payload>::Size() const
+    {
+        return RBTree::Size();
+    }
+
+    template<typename typeT, typename payload>
+    bool IntervalTree<typeT, payload>::IsEmpty()
+    {
+        return RBTree::IsEmpty();
+    }
+
+    template<typename typeT, typename payload>
+    void IntervalTree<typeT, payload>::Clear()
+    {
+        RBTree::Clear();
+    }
+
+    template<typename typeT, typename payload>
+    void IntervalTree<typeT, payload>::ValidateMaxHigh(NodeType* node) const
+    {
+        if (node == nullptr)
+            return;
+
+        NodeType* left  = node->GetLeftNode();
+        NodeType* right = node->GetRightNode();
+
+        this->ValidateMaxHigh(left);
+        this->ValidateMaxHigh(right);
+
+        Interval<typeT, payload> expected = node->GetValue();
+
+        expected.Augment(left ? &left->GetValue() : nullptr,
+                         right ? &right->GetValue() : nullptr);
+
+        if (expected.maxHigh != node->GetValue().maxHigh)
+            throw std::logic_error("A node holds a stale greatest endpoint");
+    }
+
+    template<typename typeT, typename payload>
+    void IntervalTree<typeT, payload>::Validate() const
+    {
+        RBTree::Validate();
+        this->ValidateMaxHigh(this->m_root);
+    }
+} // namespace rbtree
+
+#endif // INTERVAL_TREE_H_
@@ -9,9 +9,12 @@
 
 #include <cstddef>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
+#include <utility>
 
 #include "node.h"
+#include "reclaimer.h"
 
 // Doubly linked namespace
 namespace dlkd
@@ -31,6 +34,7 @@ namespace dlkd
             Node<typeT>* m_head;
             Node<typeT>* m_tail;
             std::size_t  m_size;
+            Node<typeT>* m_graveyard; // Detached nodes not freed yet by ClearSome
 
             /**
              * @brief Remove a node from the list.
@@ -89,6 +93,13 @@ namespace dlkd
              */
             void PushBack(typeT key);
 
+            /**
+             * @brief Insert a new key at the beginning of the list
+             * @param key The value to be stored
+             * @return Handle to the new node, valid until the node is removed
+             */
+            Node<typeT>* PushFront(typeT key);
+
             /**
              * @brief Insert a new key into the list at a specific position
              * @param key The value to be stored
@@ -102,11 +113,51 @@ namespace dlkd
              */
             void Remove(typeT key);
 
+            /**
+             * @brief Remove a node in O(1), without searching for its key
+             * @param node Handle to a node of this list
+             */
+            void Erase(Node<typeT>* node);
+
+            /**
+             * @brief Move a node to the beginning of the list in O(1)
+             * @param node Handle to a node of this list
+             */
+            void MoveToFront(Node<typeT>* node);
+
+            /**
+             * @brief Get the first node of the list
+             * @return Handle to the first node, or nullptr if the list is empty
+             */
+            Node<typeT>* GetHeadNode();
+
+            /**
+             * @brief Get the last node of the list
+             * @return Handle to the last node, or nullptr if the list is empty
+             */
+            Node<typeT>* GetTailNode();
+
             /**
              * @brief Clear the entire list
              */
             void Clear();
 
+            /**
+             * @brief Empty the list in O(1) and free its nodes on the background
+             * reclaimer thread
+             */
+            void ClearAsync();
+
+            /**
+             * @brief Free the nodes of the list a few at a time. When no teardown is
+             * pending, the call detaches every element, so the list is empty right
+             * away. Each call then frees up to 'budget' detached nodes
+             * @param budget Maximum number of nodes freed by this call
+             * @return True if every detached node was freed, False if more calls are
+             * needed
+             */
+            bool ClearSome(std::size_t budget);
+
             /**
              * @brief Search for the node containing the key
              * @param key The key to be searched
@@ -192,17 +243,19 @@ namespace dlkd
     template<typename typeT>
     List<typeT>::List()
     {
-        this->m_head = nullptr;
-        this->m_tail = nullptr;
-        this->m_size = 0;
+        this->m_head      = nullptr;
+        this->m_tail      = nullptr;
+        this->m_size      = 0;
+        this->m_graveyard = nullptr;
     }
 
     template<typename typeT>
     List<typeT>::List(const List<typeT>& other)
     {
-        m_head = nullptr;
-        m_tail = nullptr;
-        m_size = 0;
+        m_head      = nullptr;
+        m_tail      = nullptr;
+        m_size      = 0;
+        m_graveyard = nullptr;
 
         Node<typeT>* current = other.m_head;
         while (current != nullptr)
@@ -259,6 +312,23 @@ namespace dlkd
         this->m_size++;
     }
 
+    template<typename typeT>
+    Node<typeT>* List<typeT>::PushFront(typeT key)
+    {
+        if (this->m_head == nullptr)
+        {
+            this->m_head = this->m_tail = new Node<typeT>(key);
+        }
+        else
+        {
+            this->m_head->SetLeftNode(new Node<typeT>(key, this->m_head));
+            this->m_head = this->m_head->GetLeftNode();
+        }
+        this->m_size++;
+
+        return this->m_head;
+    }
+
     template<typename typeT>
     void List<typeT>::Insert(typeT key, std::size_t pos)
     {
@@ -360,6 +430,44 @@ namespace dlkd
         this->m_size--;
     }
 
+    template<typename typeT>
+    void List<typeT>::Erase(Node<typeT>* node)
+    {
+        this->Remove(node);
+    }
+
+    template<typename typeT>
+    void List<typeT>::MoveToFront(Node<typeT>* node)
+    {
+        if (node == nullptr or node == this->m_head)
+            return;
+
+        // The node is not the head, so it has a left neighbor
+        node->GetLeftNode()->SetRightNode(node->GetRightNode());
+
+        if (node == this->m_tail)
+            this->m_tail = node->GetLeftNode();
+        else
+            node->GetRightNode()->SetLeftNode(node->GetLeftNode());
+
+        node->SetLeftNode(nullptr);
+        node->SetRightNode(this->m_head);
+        this->m_head->SetLeftNode(node);
+        this->m_head = node;
+    }
+
+    template<typename typeT>
+    Node<typeT>* List<typeT>::GetHeadNode()
+    {
+        return this->m_head;
+    }
+
+    template<typename typeT>
+    Node<typeT>* List<typeT>::GetTailNode()
+    {
+        return this->m_tail;
+    }
+
     template<typename typeT>
     void List<typeT>::Clear()
     {
@@ -367,6 +475,45 @@ namespace dlkd
         {
             this->Remove(this->m_head);
         }
+
+        // Nodes left by an unfinished ClearSome
+        this->ClearSome(std::numeric_limits<std::size_t>::max());
+    }
+
+    template<typename typeT>
+    void List<typeT>::ClearAsync()
+    {
+        if (this->m_head == nullptr)
+            return;
+
+        List<typeT>* detached = new List<typeT>();
+
+        std::swap(this->m_head, detached->m_head);
+        std::swap(this->m_tail, detached->m_tail);
+        std::swap(this->m_size, detached->m_size);
+
+        utils::Reclaimer::Instance().Post([detached]() { delete detached; });
+    }
+
+    template<typename typeT>
+    bool List<typeT>::ClearSome(std::size_t budget)
+    {
+        if (this->m_graveyard == nullptr)
+        {
+            this->m_graveyard = this->m_head;
+            this->m_head      = nullptr;
+            this->m_tail      = nullptr;
+            this->m_size      = 0;
+        }
+
+        for (; budget > 0 and this->m_graveyard != nullptr; budget--)
+        {
+            Node<typeT>* next = this->m_graveyard->GetRightNode();
+            delete this->m_graveyard;
+            this->m_graveyard = next;
+        }
+
+        return this->m_graveyard == nullptr;
     }
 
     template<typename typeT>
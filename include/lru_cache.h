@@ -0,0 +1,344 @@
+/*
+ * Filename: lru_cache.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef LRU_CACHE_H_
+#define LRU_CACHE_H_
+
+#include <cstddef>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "list_dlkd.h"
+#include "node.h"
+
+namespace lru
+{
+    /**
+     * @brief Weigher that gives every entry the same weight, so the capacity of the
+     * cache is a number of entries
+     */
+    template<typename typeK, typename typeV>
+    auto ByCount = [](const typeK&, const typeV&) -> std::size_t { return 1; };
+
+    /**
+     * @brief Approximate number of bytes used by a value. Containers such as
+     * std::string also count the elements they own
+     */
+    template<typename typeT>
+    std::size_t Bytes(const typeT& value)
+    {
+        if constexpr (requires { value.size(); typename typeT::value_type; })
+            return sizeof(typeT) + value.size() * sizeof(typename typeT::value_type);
+        else
+            return sizeof(typeT);
+    }
+
+    /**
+     * @brief Weigher that measures entries in bytes, so the capacity of the cache
+     * is a memory budget
+     */
+    template<typename typeK, typename typeV>
+    auto BySize = [](const typeK& key, const typeV& value) -> std::size_t {
+        return Bytes(key) + Bytes(value);
+    };
+
+    /**
+     * @brief Least recently used cache
+     *
+     * Entries live in a dlkd::List ordered from the most to the least recently
+     * used, and a hash index maps each key to its list node. A hit moves the node
+     * to the front of the list and an eviction removes the last node, both in O(1)
+     * and without searching the list. Each entry keeps the weight it had when it
+     * was put, so a value changed through Get does not unbalance the total weight
+     *
+     * Time Complexity:
+     *   Function       Average case
+     *    get               O(1)
+     *    put               O(1)
+     *    evict             O(1)
+     *
+     * Space Complexity: O(n)
+     *
+     * @tparam typeK The type of the keys. Must be hashable by std::hash
+     * @tparam typeV The type of the values
+     * @tparam weigher Gives the weight of an entry, counted against the capacity
+     */
+    template<typename typeK,
+             typename typeV,
+             typename weigher = decltype(ByCount<typeK, typeV>)>
+    class LruCache
+    {
+        private:
+            struct Entry
+            {
+                typeK       key;
+                typeV       value;
+                std::size_t weight; // Weight given by the weigher at Put
+            };
+
+            dlkd::List<Entry>                             m_entries;
+            std::unordered_map<typeK, dlkd::Node<Entry>*> m_index;
+
+            std::size_t m_capacity;
+            std::size_t m_weight;
+
+            std::size_t m_hits;
+            std::size_t m_misses;
+            std::size_t m_evictions;
+
+            weigher m_weigher;
+
+            /**
+             * @brief Remove the node of an entry from the list and from the index
+             * @param node The node to be removed
+             */
+            void Erase(dlkd::Node<Entry>* node);
+
+        public:
+            /**
+             * @brief Constructor
+             * @param capacity Maximum total weight of the entries
+             * @param weigh Gives the weight of an entry
+             * @throw std::invalid_argument If the capacity is zero
+             */
+            LruCache(std::size_t capacity, const weigher& weigh = weigher());
+
+            // The index points to the nodes of this cache's list
+            LruCache(const LruCache&)            = delete;
+            LruCache& operator=(const LruCache&) = delete;
+
+            /**
+             * @brief Get the value of a key and mark it as the most recently used
+             * @param key Key to be looked up
+             * @return Pointer to the value, or nullptr on a miss. The pointer is valid
+             * until the entry is evicted or removed. Changing the value through it
+             * does not change the weight of the entry; call Put to weigh it again
+             */
+            typeV* Get(const typeK& key);
+
+            /**
+             * @brief Insert or update an entry and mark it as the most recently used.
+             * The least recently used entries are evicted until the total weight fits
+             * the capacity. An entry heavier than the whole capacity is not stored
+             * @param key Key of the entry
+             * @param value Value of the entry
+             */
+            void Put(const typeK& key, const typeV& value);
+
+            /**
+             * @brief Remove an entry
+             * @param key Key of the entry
+             * @return True if the entry was in the cache, False otherwise
+             */
+            bool Remove(const typeK& key);
+
+            /**
+             * @brief Evict the least recently used entry
+             * @throw std::underflow_error If the cache is empty
+             */
+            void Evict();
+
+            /**
+             * @brief Check if a key is in the cache, without changing its recency
+             * @param key Key to be looked up
+             * @return True if the key was found, False otherwise
+             */
+            bool Contains(const typeK& key) const;
+
+            /**
+             * @brief Remove every entry. The counters are kept
+             */
+            void Clear();
+
+            /**
+             * @return The number of entries in the cache
+             */
+            std::size_t Size() const;
+
+            /**
+             * @return True if the cache is empty, False otherwise
+             */
+            bool IsEmpty() const;
+
+            /**
+             * @return The total weight of the entries in the cache
+             */
+            std::size_t Weight() const;
+
+            /**
+             * @return The maximum total weight of the entries
+             */
+            std::size_t Capacity() const;
+
+            /**
+             * @return Number of calls to Get that found the key
+             */
+            std::size_t Hits() const;
+
+            /**
+             * @return Number of calls to Get that did not find the key
+             */
+            std::size_t Misses() const;
+
+            /**
+             * @return Number of entries evicted to respect the capacity or by Evict
+             */
+            std::size_t Evictions() const;
+
+            /**
+             * @brief Reset the hit, miss and eviction counters
+             */
+            void ResetStats();
+    };
+
+    template<typename typeK, typename typeV, typename weigher>
+    LruCache<typeK, typeV, weigher>::LruCache(std::size_t    capacity,
+                                              const weigher& weigh)
+        : m_capacity(capacity),
+          m_weight(0),
+          m_hits(0),
+          m_misses(0),
+          m_evictions(0),
+          m_weigher(weigh)
+    {
+        if (capacity == 0)
+            throw std::invalid_argument("Capacity must be greater than zero");
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    void LruCache<typeK, typeV, weigher>::Erase(dlkd::Node<Entry>* node)
+    {
+        Entry& entry = node->GetValue();
+
+        this->m_weight -= entry.weight;
+        this->m_index.erase(entry.key);
+        this->m_entries.Erase(node);
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    typeV* LruCache<typeK, typeV, weigher>::Get(const typeK& key)
+    {
+        auto it = this->m_index.find(key);
+
+        if (it == this->m_index.end())
+        {
+            this->m_misses++;
+            return nullptr;
+        }
+
+        this->m_hits++;
+        this->m_entries.MoveToFront(it->second);
+
+        return &it->second->GetValue().value;
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    void LruCache<typeK, typeV, weigher>::Put(const typeK& key, const typeV& value)
+    {
+        std::size_t weight = this->m_weigher(key, value);
+        auto        it     = this->m_index.find(key);
+
+        if (it != this->m_index.end())
+            this->Erase(it->second);
+
+        if (weight > this->m_capacity)
+            return;
+
+        while (this->m_weight + weight > this->m_capacity)
+            this->Evict();
+
+        this->m_index[key] = this->m_entries.PushFront(Entry { key, value, weight });
+        this->m_weight += weight;
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    bool LruCache<typeK, typeV, weigher>::Remove(const typeK& key)
+    {
+        auto it = this->m_index.find(key);
+
+        if (it == this->m_index.end())
+            return false;
+
+        this->Erase(it->second);
+        return true;
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    void LruCache<typeK, typeV, weigher>::Evict()
+    {
+        if (this->IsEmpty())
+            throw std::underflow_error("Cache is empty!");
+
+        this->Erase(this->m_entries.GetTailNode());
+        this->m_evictions++;
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    bool LruCache<typeK, typeV, weigher>::Contains(const typeK& key) const
+    {
+        return this->m_index.find(key) != this->m_index.end();
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    void LruCache<typeK, typeV, weigher>::Clear()
+    {
+        this->m_entries.Clear();
+        this->m_index.clear();
+        this->m_weight = 0;
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    std::size_t LruCache<typeK, typeV, weigher>::Size() const
+    {
+        return this->m_index.size();
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    bool LruCache<typeK, typeV, weigher>::IsEmpty() const
+    {
+        return this->m_index.empty();
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    std::size_t LruCache<typeK, typeV, weigher>::Weight() const
+    {
+        return this->m_weight;
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    std::size_t LruCache<typeK, typeV, weigher>::Capacity() const
+    {
+        return this->m_capacity;
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    std::size_t LruCache<typeK, typeV, weigher>::Hits() const
+    {
+        return this->m_hits;
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    std::size_t LruCache<typeK, typeV, weigher>::Misses() const
+    {
+        return this->m_misses;
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    std::size_t LruCache<typeK, typeV, weigher>::Evictions() const
+    {
+        return this->m_evictions;
+    }
+
+    template<typename typeK, typename typeV, typename weigher>
+    void LruCache<typeK, typeV, weigher>::ResetStats()
+    {
+        this->m_hits      = 0;
+        this->m_misses    = 0;
+        this->m_evictions = 0;
+    }
+} // namespace lru
+
+#endif // LRU_CACHE_H_
@@ -7,7 +7,17 @@
 #ifndef MAP_H_
 #define MAP_H_
 
+#include <cstdio>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
 #include "comparators.h"
+#include "frozen_map.h"
+#include "mapped_map.h"
 #include "node_rbtree.h"
 #include "pair.h"
 #include "red_black_tree.h"
@@ -34,24 +44,56 @@ namespace rbtree
      *
      * @tparam typeK The type of the keys in the map
      * @tparam typeV The type of the values associated with the keys
+     * @tparam nodeT The node layout used by the underlying tree
      */
-    template<typename typeK, typename typeV>
+    template<typename typeK, typename typeV, template<typename> class nodeT = Node>
     class Map : private RedBlackTree<Pair<typeK, typeV>,
                                      decltype(comparators::PairLess<typeK, typeV>),
-                                     decltype(comparators::PairEqual<typeK, typeV>)>
+                                     decltype(comparators::PairEqual<typeK, typeV>),
+                                     nodeT>
     {
         private:
             using RBTree = RedBlackTree<Pair<typeK, typeV>,
                                         decltype(comparators::PairLess<typeK, typeV>),
-                                        decltype(comparators::PairEqual<typeK, typeV>)>;
+                                        decltype(comparators::PairEqual<typeK, typeV>),
+                                        nodeT>;
 
-            using NodeType = Node<Pair<typeK, typeV>>;
+            using NodeType = nodeT<Pair<typeK, typeV>>;
 
         public:
             Map();
 
+            /**
+             * @brief Copy constructor. Copies the shape of the other map in O(n), with
+             * every node in a single allocation laid out in key order
+             */
+            Map(const Map& other);
+
+            /**
+             * @brief Move constructor. O(1): the other map becomes empty
+             */
+            Map(Map&& other);
+
             ~Map();
 
+            /**
+             * @brief Copy assignment operator. O(n), see the copy constructor
+             */
+            Map& operator=(const Map& other);
+
+            /**
+             * @brief Move assignment operator. O(1) besides deleting the elements of
+             * this map. The other map becomes empty
+             */
+            Map& operator=(Map&& other);
+
+            /**
+             * @brief Exchange the contents of two maps in O(1). Iterators and node
+             * pointers follow their elements
+             * @param other The other map
+             */
+            void Swap(Map& other);
+
             /**
              * @brief Overload of the operator []
              * @param key Key to be looked up
@@ -86,6 +128,53 @@ namespace rbtree
              */
             NodeType* Insert(const typeK& key, const typeV& value);
 
+            /**
+             * @brief Insert an element starting from a node next to its position, in
+             * amortized O(1) when the key belongs right before or right after the hint
+             * @param hint A node of this map near the key, such as the node returned
+             * by the previous insertion. nullptr hints the end of the map, as Append
+             * @param key, value Key and value to be inserted
+             * @return Pointer to the inserted node, or to the node that already had the
+             * key
+             */
+            NodeType* Insert(NodeType* hint, const typeK& key, const typeV& value);
+
+            /**
+             * @brief Append an element whose key is greater than every key of the map
+             * in amortized O(1). Other keys fall back to the usual insertion
+             * @param key, value Key and value to be inserted
+             * @return Pointer to the inserted node, or to the node that already had the
+             * key
+             */
+            NodeType* Append(const typeK& key, const typeV& value);
+
+            /**
+             * @brief Insert an element even if the key is already in the map, turning
+             * the map into a multimap. The copies of a key are kept in insertion
+             * order. Operator [], At and Get return one of the copies
+             *
+             * Each copy takes a whole node, so many copies of few keys use more
+             * memory and time than grouping the values of a key in one node, as
+             * Map<typeK, Vector<typeV>> does. It fits keys with a few copies that
+             * are looked up and removed one by one. To only count copies, use
+             * MultiSet, which keeps one node per distinct key
+             * @param key, value Key and value to be inserted
+             * @return Pointer to the new node
+             */
+            NodeType* InsertMulti(const typeK& key, const typeV& value);
+
+            /**
+             * @brief Count the elements with a key in O(log n + k)
+             * @return The number of elements with the key
+             */
+            std::size_t Count(const typeK& key);
+
+            /**
+             * @brief Remove every element with a key
+             * @return The number of removed elements
+             */
+            std::size_t RemoveAll(const typeK& key);
+
             /**
              * @return Number of elements in the map
              */
@@ -102,6 +191,34 @@ namespace rbtree
              **/
             bool Contains(const typeK& key);
 
+            /**
+             * @brief Insert a batch of key-value pairs. The batch is sorted first and
+             * each pair is inserted with the previous one as hint, so runs of keys
+             * that land between the same two nodes of the map skip the descent from
+             * the root
+             * @param pairs Pairs to be inserted. Keys already in the map keep their
+             * value, as in Insert
+             */
+            void InsertBatch(std::span<const Pair<typeK, typeV>> pairs);
+
+            /**
+             * @brief Check a batch of keys, interleaving the descents so that their
+             * cache misses overlap
+             * @param keys Keys to be looked up
+             * @param out Receives True for each key found, False otherwise
+             * @throw std::invalid_argument If 'out' is smaller than 'keys'
+             */
+            void ContainsBatch(std::span<const typeK> keys, std::span<bool> out);
+
+            /**
+             * @brief Get the values of a batch of keys, interleaving the descents so
+             * that their cache misses overlap
+             * @param keys Keys to be looked up
+             * @param out Receives a pointer to the value of each key, or nullptr
+             * @throw std::invalid_argument If 'out' is smaller than 'keys'
+             */
+            void GetBatch(std::span<const typeK> keys, std::span<typeV*> out);
+
             /**
              * @brief Removes an element from the map
              * @param key Key of the element to be removed
@@ -113,6 +230,118 @@ namespace rbtree
              */
             void Clear();
 
+            /**
+             * @brief Empty the map in O(1) and free its nodes on the background
+             * reclaimer thread
+             */
+            void ClearAsync();
+
+            /**
+             * @brief Free the elements of the map a few at a time. When no teardown
+             * is pending, the call detaches every element, so the map is empty right
+             * away. Each call then frees up to 'budget' detached elements
+             * @param budget Maximum number of elements freed by this call
+             * @return True if every detached element was freed, False if more calls
+             * are needed
+             */
+            bool ClearSome(std::size_t budget);
+
+            /**
+             * @brief Move every element of 'other' to the end of this map in O(log n)
+             * @param other Map whose keys are all greater than the keys of this map
+             * @throw std::invalid_argument If the key ranges overlap
+             */
+            void Join(Map& other);
+
+            /**
+             * @brief Split the map by a key. This map keeps the keys smaller than
+             * 'key' and 'right' receives the other ones. The split itself takes
+             * O(log n), and counting the smaller side takes O(min(k, n - k)) more,
+             * where k is the number of keys smaller than 'key'
+             */
+            void Split(const typeK& key, Map& right);
+
+            /**
+             * @brief Move every element of 'other' into this map. On equal keys, the
+             * value of this map is kept. 'other' becomes empty
+             * @param numThreads Number of threads used by the recursion
+             */
+            void Union(Map& other, std::size_t numThreads = 1);
+
+            /**
+             * @brief Keep only the keys that are also in 'other'. 'other' becomes
+             * empty
+             * @param numThreads Number of threads used by the recursion
+             */
+            void Intersection(Map& other, std::size_t numThreads = 1);
+
+            /**
+             * @brief Remove the keys that are in 'other'. 'other' becomes empty
+             * @param numThreads Number of threads used by the recursion
+             */
+            void Difference(Map& other, std::size_t numThreads = 1);
+
+            /**
+             * @brief Copy the map into an immutable map in Eytzinger layout, which
+             * answers lookups much faster than the tree. The map is not modified
+             * @return The frozen map
+             */
+            FrozenMap<typeK, typeV> Freeze();
+
+            /**
+             * @brief Write the map to a snapshot file that MappedMap can serve without
+             * deserialization. Keys and values are stored sorted, in page-aligned
+             * arrays. The snapshot is written to 'filename'.tmp and renamed over
+             * 'filename' once complete, so a MappedMap serving the old file keeps its
+             * pages and a failed export never leaves a partial snapshot behind
+             * @param filename Path of the file to be written
+             * @param sparseIndex If True, also store one key per page of keys, which
+             * keeps the cold part of a lookup to a single page of keys
+             * @throw std::runtime_error If the file cannot be written
+             */
+            void Export(const std::string& filename, bool sparseIndex = true);
+
+            /**
+             * @brief Measure the shape of the underlying tree in O(n), with a snapshot
+             * of its telemetry counters when RBTREE_TELEMETRY is defined
+             * @return The stats of the tree
+             */
+            TreeStats Stats() const;
+
+            /**
+             * @brief Set the telemetry counters to zero. Does nothing when
+             * RBTREE_TELEMETRY is not defined
+             */
+            void ResetTelemetry();
+
+            /**
+             * @brief Move every node into a single arena in key order, so iteration
+             * walks memory sequentially. Invalidates iterators and node pointers
+             */
+            void Compact();
+
+            /**
+             * @brief Run a bounded part of a compaction. Invalidates iterators and
+             * node pointers
+             * @param budget Maximum number of nodes moved by this call
+             * @return True if the compaction is finished, False if more steps are
+             * needed
+             */
+            bool CompactStep(std::size_t budget);
+
+            /**
+             * @brief Check every invariant of the underlying tree in O(n)
+             * @throw std::logic_error Describing the first violation found
+             */
+            void Validate() const;
+
+            /**
+             * @brief Check the invariants along one random path of the underlying
+             * tree after every 'interval' insertions and removals
+             * @param interval Number of mutations between checks. 0 disables it
+             */
+            void SetValidationInterval(std::size_t interval);
+
             // iterator
             using pointer   = NodeType*;
             using reference = NodeType&;
@@ -212,33 +441,83 @@ namespace rbtree
             {
                 return Iterator(nullptr);
             }
+
+            /**
+             * @brief Overload of the hinted insertion taking an iterator. end() hints
+             * the end of the map
+             */
+            NodeType* Insert(Iterator hint, const typeK& key, const typeV& value)
+            {
+                return this->Insert(hint.operator->(), key, value);
+            }
+
+            /**
+             * @brief Get the elements with a key
+             * @return Iterators to the first element with the key and to the element
+             * after the last one. Both are equal when the key is not in the map
+             */
+            Pair<Iterator, Iterator> EqualRange(const typeK& key)
+            {
+                auto range = RBTree::EqualRange(Pair<typeK, typeV>(key, typeV()));
+
+                return Pair<Iterator, Iterator>(Iterator(range.GetFirst()),
+                                                Iterator(range.GetSecond()));
+            }
     };
 
-    template<typename typeK, typename typeV>
-    Map<typeK, typeV>::Map()
-        : RedBlackTree<Pair<typeK, typeV>,
-                       decltype(comparators::PairLess<typeK, typeV>),
-                       decltype(comparators::PairEqual<typeK, typeV>)>()
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    Map<typeK, typeV, nodeT>::Map()
+        : RBTree()
+    { }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    Map<typeK, typeV, nodeT>::Map(const Map& other)
+        : RBTree(other)
     { }
 
-    template<typename typeK, typename typeV>
-    Map<typeK, typeV>::~Map()
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    Map<typeK, typeV, nodeT>::Map(Map&& other)
+        : RBTree(std::move(other))
     { }
 
-    template<typename typeK, typename typeV>
-    typeV& Map<typeK, typeV>::operator[](const typeK& key)
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    Map<typeK, typeV, nodeT>::~Map()
+    { }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    Map<typeK, typeV, nodeT>& Map<typeK, typeV, nodeT>::operator=(const Map& other)
+    {
+        RBTree::operator=(other);
+        return *this;
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    Map<typeK, typeV, nodeT>& Map<typeK, typeV, nodeT>::operator=(Map&& other)
+    {
+        RBTree::operator=(std::move(other));
+        return *this;
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::Swap(Map& other)
+    {
+        RBTree::Swap(other);
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    typeV& Map<typeK, typeV, nodeT>::operator[](const typeK& key)
     {
         return RBTree::Insert(Pair<typeK, typeV>(key, typeV()))->GetValue().GetSecond();
     }
 
-    template<typename typeK, typename typeV>
-    typeV& Map<typeK, typeV>::At(const typeK& key)
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    typeV& Map<typeK, typeV, nodeT>::At(const typeK& key)
     {
         return RBTree::Insert(Pair<typeK, typeV>(key, typeV()))->GetValue().GetSecond();
     }
 
-    template<typename typeK, typename typeV>
-    typeV& Map<typeK, typeV>::Get(const typeK& key)
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    typeV& Map<typeK, typeV, nodeT>::Get(const typeK& key)
     {
         NodeType* node = RBTree::Search(Pair<typeK, typeV>(key, typeV()));
 
@@ -248,42 +527,311 @@ namespace rbtree
         return node->GetValue().GetSecond();
     }
 
-    template<typename typeK, typename typeV>
-    Node<Pair<typeK, typeV>>* Map<typeK, typeV>::Insert(const typeK& key,
-                                                        const typeV& value)
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    nodeT<Pair<typeK, typeV>>* Map<typeK, typeV, nodeT>::Insert(const typeK& key,
+                                                                const typeV& value)
     {
         return RBTree::Insert(Pair<typeK, typeV>(key, value));
     }
 
-    template<typename typeK, typename typeV>
-    std::size_t Map<typeK, typeV>::Size() const
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    nodeT<Pair<typeK, typeV>>* Map<typeK, typeV, nodeT>::Insert(NodeType*    hint,
+                                                                const typeK& key,
+                                                                const typeV& value)
+    {
+        return RBTree::Insert(hint, Pair<typeK, typeV>(key, value));
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    nodeT<Pair<typeK, typeV>>* Map<typeK, typeV, nodeT>::Append(const typeK& key,
+                                                                const typeV& value)
+    {
+        return RBTree::Append(Pair<typeK, typeV>(key, value));
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    nodeT<Pair<typeK, typeV>>*
+    Map<typeK, typeV, nodeT>::InsertMulti(const typeK& key, const typeV& value)
+    {
+        return RBTree::InsertMulti(Pair<typeK, typeV>(key, value));
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    std::size_t Map<typeK, typeV, nodeT>::Count(const typeK& key)
+    {
+        return RBTree::Count(Pair<typeK, typeV>(key, typeV()));
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    std::size_t Map<typeK, typeV, nodeT>::RemoveAll(const typeK& key)
+    {
+        return RBTree::RemoveAll(Pair<typeK, typeV>(key, typeV()));
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    std::size_t Map<typeK, typeV, nodeT>::Size() const
     {
         return RBTree::Size();
     }
 
-    template<typename typeK, typename typeV>
-    bool Map<typeK, typeV>::IsEmpty()
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    bool Map<typeK, typeV, nodeT>::IsEmpty()
     {
         return RBTree::IsEmpty();
     }
 
-    template<typename typeK, typename typeV>
-    bool Map<typeK, typeV>::Contains(const typeK& key)
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    bool Map<typeK, typeV, nodeT>::Contains(const typeK& key)
     {
         return (RBTree::Search(Pair<typeK, typeV>(key, typeV())) != nullptr);
     }
 
-    template<typename typeK, typename typeV>
-    void Map<typeK, typeV>::Remove(const typeK& key)
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::InsertBatch(
+        std::span<const Pair<typeK, typeV>> pairs)
+    {
+        RBTree::InsertBatch(pairs);
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::ContainsBatch(std::span<const typeK> keys,
+                                                 std::span<bool>        out)
+    {
+        if (out.size() < keys.size())
+            throw std::invalid_argument("Output is smaller than the batch");
+
+        Pair<typeK, typeV> probes[RBTREE_BATCH_GROUP];
+        NodeType*          nodes[RBTREE_BATCH_GROUP];
+
+        for (std::size_t start = 0; start < keys.size(); start += RBTREE_BATCH_GROUP)
+        {
+            std::size_t count =
+                comparators::Min<std::size_t>(RBTREE_BATCH_GROUP, keys.size() - start);
+
+            for (std::size_t i = 0; i < count; i++)
+                probes[i].SetFirst(keys[start + i]);
+
+            RBTree::SearchGroup(probes, count, nodes);
+
+            for (std::size_t i = 0; i < count; i++)
+                out[start + i] = nodes[i] != nullptr;
+        }
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::GetBatch(std::span<const typeK> keys,
+                                            std::span<typeV*>      out)
+    {
+        if (out.size() < keys.size())
+            throw std::invalid_argument("Output is smaller than the batch");
+
+        Pair<typeK, typeV> probes[RBTREE_BATCH_GROUP];
+        NodeType*          nodes[RBTREE_BATCH_GROUP];
+
+        for (std::size_t start = 0; start < keys.size(); start += RBTREE_BATCH_GROUP)
+        {
+            std::size_t count =
+                comparators::Min<std::size_t>(RBTREE_BATCH_GROUP, keys.size() - start);
+
+            for (std::size_t i = 0; i < count; i++)
+                probes[i].SetFirst(keys[start + i]);
+
+            RBTree::SearchGroup(probes, count, nodes);
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                out[start + i] =
+                    nodes[i] != nullptr ? &nodes[i]->GetValue().GetSecond() : nullptr;
+            }
+        }
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::Remove(const typeK& key)
     {
         RBTree::Remove(Pair<typeK, typeV>(key, typeV()));
     }
 
-    template<typename typeK, typename typeV>
-    void Map<typeK, typeV>::Clear()
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::Clear()
     {
         RBTree::Clear();
     }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::ClearAsync()
+    {
+        RBTree::ClearAsync();
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    bool Map<typeK, typeV, nodeT>::ClearSome(std::size_t budget)
+    {
+        return RBTree::ClearSome(budget);
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::Join(Map& other)
+    {
+        RBTree::Join(other);
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::Split(const typeK& key, Map& right)
+    {
+        RBTree::Split(Pair<typeK, typeV>(key, typeV()), right);
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::Union(Map& other, std::size_t numThreads)
+    {
+        RBTree::Union(other, numThreads);
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::Intersection(Map& other, std::size_t numThreads)
+    {
+        RBTree::Intersection(other, numThreads);
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::Difference(Map& other, std::size_t numThreads)
+    {
+        RBTree::Difference(other, numThreads);
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    FrozenMap<typeK, typeV> Map<typeK, typeV, nodeT>::Freeze()
+    {
+        Iterator it = this->begin();
+
+        auto next = [&it]() -> const Pair<typeK, typeV>& { return *it++; };
+
+        return FrozenMap<typeK, typeV>(this->Size(), next);
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::Export(const std::string& filename, bool sparseIndex)
+    {
+        static_assert(std::is_trivially_copyable_v<typeK> and
+                          std::is_trivially_copyable_v<typeV>,
+                      "Export requires trivially copyable keys and values");
+
+        std::string   temporary = filename + ".tmp";
+        std::ofstream output(temporary, std::ios::binary | std::ios::trunc);
+
+        if (not output.is_open())
+            throw std::runtime_error("Error opening file " + temporary);
+
+        std::uint64_t size = this->Size();
+
+        MappedMapHeader header = {};
+        header.magic           = MAPPED_MAP_MAGIC;
+        header.version         = MAPPED_MAP_VERSION;
+        header.keySize         = sizeof(typeK);
+        header.valueSize       = sizeof(typeV);
+        header.size            = size;
+        header.keysOffset      = MappedMapAlign(sizeof(MappedMapHeader));
+        header.valuesOffset =
+            MappedMapAlign(header.keysOffset + size * sizeof(typeK));
+
+        if (sparseIndex and size > 0)
+        {
+            header.indexStride = MAPPED_MAP_PAGE_SIZE / sizeof(typeK) > 0
+                                     ? MAPPED_MAP_PAGE_SIZE / sizeof(typeK)
+                                     : 1;
+            header.indexSize   = (size + header.indexStride - 1) / header.indexStride;
+            header.indexOffset =
+                MappedMapAlign(header.valuesOffset + size * sizeof(typeV));
+        }
+
+        std::uint64_t position = 0;
+
+        auto write = [&output, &position](const void* data, std::size_t bytes) {
+            output.write(static_cast<const char*>(data), bytes);
+            position += bytes;
+        };
+
+        // Fill with zeros up to the start of the next section
+        auto pad = [&output, &position](std::uint64_t offset) {
+            for (; position < offset; position++)
+                output.put('\0');
+        };
+
+        write(&header, sizeof(header));
+
+        pad(header.keysOffset);
+        for (Pair<typeK, typeV>& pair : *this)
+            write(&pair.GetFirst(), sizeof(typeK));
+
+        pad(header.valuesOffset);
+        for (Pair<typeK, typeV>& pair : *this)
+            write(&pair.GetSecond(), sizeof(typeV));
+
+        if (header.indexOffset != 0)
+        {
+            pad(header.indexOffset);
+
+            std::uint64_t i = 0;
+            for (Pair<typeK, typeV>& pair : *this)
+            {
+                if (i++ % header.indexStride == 0)
+                    write(&pair.GetFirst(), sizeof(typeK));
+            }
+        }
+
+        output.flush();
+        output.close();
+
+        if (output.fail())
+        {
+            std::remove(temporary.c_str());
+            throw std::runtime_error("Error writing file " + temporary);
+        }
+
+        // Readers that mapped the old file keep it until they unmap it
+        if (std::rename(temporary.c_str(), filename.c_str()) != 0)
+        {
+            std::remove(temporary.c_str());
+            throw std::runtime_error("Error renaming " + temporary + " to " + filename);
+        }
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    TreeStats Map<typeK, typeV, nodeT>::Stats() const
+    {
+        return RBTree::Stats();
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::ResetTelemetry()
+    {
+        RBTree::ResetTelemetry();
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::Compact()
+    {
+        RBTree::Compact();
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    bool Map<typeK, typeV, nodeT>::CompactStep(std::size_t budget)
+    {
+        return RBTree::CompactStep(budget);
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::Validate() const
+    {
+        RBTree::Validate();
+    }
+
+    template<typename typeK, typename typeV, template<typename> class nodeT>
+    void Map<typeK, typeV, nodeT>::SetValidationInterval(std::size_t interval)
+    {
+        RBTree::SetValidationInterval(interval);
+    }
 } // namespace rbtree
 
 #endif // MAP_H_
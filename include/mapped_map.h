@@ -0,0 +1,497 @@
+/*
+ * Filename: mapped_map.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef MAPPED_MAP_H_
+#define MAPPED_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "comparators.h"
+
+// Every section of the file starts at a multiple of this size
+#define MAPPED_MAP_PAGE_SIZE 4096
+
+// File identification, written as a native integer so that a file produced on a
+// machine with another byte order is rejected
+#define MAPPED_MAP_MAGIC 0x50414D4442524B52ULL
+#define MAPPED_MAP_VERSION 1
+
+namespace rbtree
+{
+    /**
+     * @brief Header stored in the first page of a map snapshot
+     *
+     * Layout of the file, each section aligned to MAPPED_MAP_PAGE_SIZE:
+     *   header | keys (sorted) | values (same order) | sparse index
+     *
+     * The sparse index holds every 'indexStride'-th key, one per page of keys, so a
+     * lookup binary searches the small index and then a single page of keys
+     */
+    struct MappedMapHeader
+    {
+            std::uint64_t magic;
+            std::uint32_t version;
+            std::uint32_t keySize;
+            std::uint32_t valueSize;
+            std::uint32_t reserved;
+            std::uint64_t size;
+            std::uint64_t keysOffset;
+            std::uint64_t valuesOffset;
+            std::uint64_t indexOffset; // 0 if the file has no sparse index
+            std::uint64_t indexSize;
+            std::uint64_t indexStride;
+    };
+
+    /**
+     * @brief Round an offset up to the next page boundary
+     * @param offset The offset
+     * @return The aligned offset
+     */
+    inline std::uint64_t MappedMapAlign(std::uint64_t offset)
+    {
+        return (offset + MAPPED_MAP_PAGE_SIZE - 1) / MAPPED_MAP_PAGE_SIZE *
+               MAPPED_MAP_PAGE_SIZE;
+    }
+
+    /**
+     * @brief Read-only map served straight from a memory-mapped snapshot
+     *
+     * Opening a snapshot only maps the file and checks its header, so the cost does
+     * not depend on the number of keys. Pages are loaded by the kernel on first
+     * access. Snapshots are written by Map::Export
+     *
+     * Time Complexity:
+     *   Function       Worst case
+     *    open             O(1)
+     *    search         O(log n)
+     *    range        O(log n + k)
+     *
+     * @tparam typeK The type of the keys. Must be trivially copyable
+     * @tparam typeV The type of the values. Must be trivially copyable
+     * @tparam lessComparator The custom comparator for less-than comparisons
+     * @tparam equalComparator The custom comparator for equal comparisons
+     */
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator  = decltype(comparators::Less<typeK>),
+             typename equalComparator = decltype(comparators::Equal<typeK>)>
+    class MappedMap
+    {
+        private:
+            static_assert(std::is_trivially_copyable_v<typeK> and
+                              std::is_trivially_copyable_v<typeV>,
+                          "MappedMap requires trivially copyable keys and values");
+
+            void*       m_mapping;
+            std::size_t m_length;
+
+            const typeK* m_keys;
+            const typeV* m_values;
+            const typeK* m_index;
+            std::size_t  m_size;
+            std::size_t  m_indexSize;
+            std::size_t  m_indexStride;
+
+            // Custom comparators
+            lessComparator  m_lessComp;
+            equalComparator m_equalComp;
+
+            /**
+             * @brief Unmap the file
+             */
+            void Close();
+
+            /**
+             * @brief Find the first key that is not less than 'key'
+             * @param key The key used in the search
+             * @return Its position in the key array, or Size() if there is none
+             */
+            std::size_t LowerBound(const typeK& key) const;
+
+        public:
+            /**
+             * @brief Map a snapshot file
+             * @param filename Path of a file written by Map::Export
+             * @throw std::runtime_error If the file cannot be mapped, was not
+             * written for these key and value types, or its header describes
+             * sections that are misaligned or do not fit in the file
+             */
+            MappedMap(const std::string& filename);
+
+            MappedMap(MappedMap&& other);
+
+            MappedMap& operator=(MappedMap&& other);
+
+            MappedMap(const MappedMap&)            = delete;
+            MappedMap& operator=(const MappedMap&) = delete;
+
+            ~MappedMap();
+
+            /**
+             * @brief Returns the number of keys in the map
+             * @return Number of keys in the map
+             */
+            std::size_t Size() const;
+
+            /**
+             * @brief Checks if the map is empty
+             * @return True if it's empty, False otherwise
+             */
+            bool IsEmpty() const;
+
+            /**
+             * @brief Get the value associated with a key
+             * @param key Key to be looked up
+             * @return The value corresponding to the key
+             * @throw std::out_of_range If the key is not in the map
+             */
+            const typeV& Get(const typeK& key) const;
+
+            /**
+             * @brief Search for the value associated with a key
+             * @param key Key to be looked up
+             * @return Pointer to the value, or nullptr if the key is not in the map
+             */
+            const typeV* Search(const typeK& key) const;
+
+            /**
+             * @brief Checks if a key is in the map
+             * @param key Key to be looked up
+             * @return True if the key was found, False otherwise
+             */
+            bool Contains(const typeK& key) const;
+
+            /**
+             * @brief Call a function for each pair whose key is in [low, high], in
+             * ascending key order
+             * @param low Smallest key of the range
+             * @param high Greatest key of the range
+             * @param function Callable that receives const references to the key and
+             * to the value
+             */
+            template<typename Function>
+            void Range(const typeK& low, const typeK& high, Function function) const;
+    };
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    MappedMap<typeK, typeV, lessComparator, equalComparator>::MappedMap(
+        const std::string& filename)
+        : m_mapping(nullptr),
+          m_length(0),
+          m_keys(nullptr),
+          m_values(nullptr),
+          m_index(nullptr),
+          m_size(0),
+          m_indexSize(0),
+          m_indexStride(0)
+    {
+        int fd = open(filename.c_str(), O_RDONLY);
+
+        if (fd < 0)
+            throw std::runtime_error("Error opening file " + filename);
+
+        struct stat info;
+
+        if (fstat(fd, &info) != 0 or
+            static_cast<std::size_t>(info.st_size) < sizeof(MappedMapHeader))
+        {
+            close(fd);
+            throw std::runtime_error("Invalid map snapshot " + filename);
+        }
+
+        this->m_length  = static_cast<std::size_t>(info.st_size);
+        this->m_mapping = mmap(nullptr, this->m_length, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        // The mapping keeps its own reference to the file
+        close(fd);
+
+        if (this->m_mapping == MAP_FAILED)
+        {
+            this->m_mapping = nullptr;
+            throw std::runtime_error("Error mapping file " + filename);
+        }
+
+        const MappedMapHeader* header =
+            static_cast<const MappedMapHeader*>(this->m_mapping);
+
+        // Checks that 'count' elements of 'size' bytes starting at 'offset' are inside
+        // the file, without overflowing
+        std::size_t length = this->m_length;
+        auto fits = [length](std::uint64_t offset,
+                             std::uint64_t count,
+                             std::size_t   size) -> bool {
+            return offset <= length and count <= (length - offset) / size;
+        };
+
+        // Every index entry must name a key of the file: entry i is the key at
+        // i * indexStride, so the last entry must be below 'size'. Written as a
+        // division so that a corrupt stride cannot overflow
+        bool indexValid = header->indexOffset == 0 or header->indexSize == 0 or
+                          (header->indexStride != 0 and header->size != 0 and
+                           header->indexSize - 1 <=
+                               (header->size - 1) / header->indexStride);
+
+        bool valid = header->magic == MAPPED_MAP_MAGIC and
+                     header->version == MAPPED_MAP_VERSION and
+                     header->keySize == sizeof(typeK) and
+                     header->valueSize == sizeof(typeV) and
+                     header->keysOffset % alignof(typeK) == 0 and
+                     header->valuesOffset % alignof(typeV) == 0 and
+                     header->indexOffset % alignof(typeK) == 0 and
+                     fits(header->keysOffset, header->size, sizeof(typeK)) and
+                     fits(header->valuesOffset, header->size, sizeof(typeV)) and
+                     fits(header->indexOffset, header->indexSize, sizeof(typeK)) and
+                     indexValid;
+
+        if (not valid)
+        {
+            this->Close();
+            throw std::runtime_error("Invalid map snapshot " + filename);
+        }
+
+        const char* base = static_cast<const char*>(this->m_mapping);
+
+        this->m_size   = header->size;
+        this->m_keys   = reinterpret_cast<const typeK*>(base + header->keysOffset);
+        this->m_values = reinterpret_cast<const typeV*>(base + header->valuesOffset);
+
+        if (header->indexOffset != 0 and header->indexStride != 0)
+        {
+            this->m_index = reinterpret_cast<const typeK*>(base + header->indexOffset);
+            this->m_indexSize   = header->indexSize;
+            this->m_indexStride = header->indexStride;
+        }
+
+        // Lookups jump around the file, so read-ahead would mostly load unused pages
+        madvise(this->m_mapping, this->m_length, MADV_RANDOM);
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    MappedMap<typeK, typeV, lessComparator, equalComparator>::MappedMap(
+        MappedMap&& other)
+        : m_mapping(other.m_mapping),
+          m_length(other.m_length),
+          m_keys(other.m_keys),
+          m_values(other.m_values),
+          m_index(other.m_index),
+          m_size(other.m_size),
+          m_indexSize(other.m_indexSize),
+          m_indexStride(other.m_indexStride),
+          m_lessComp(other.m_lessComp),
+          m_equalComp(other.m_equalComp)
+    {
+        other.m_mapping = nullptr;
+        other.Close();
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    MappedMap<typeK, typeV, lessComparator, equalComparator>&
+    MappedMap<typeK, typeV, lessComparator, equalComparator>::operator=(
+        MappedMap&& other)
+    {
+        if (this == &other)
+            return *this;
+
+        this->Close();
+
+        this->m_mapping     = other.m_mapping;
+        this->m_length      = other.m_length;
+        this->m_keys        = other.m_keys;
+        this->m_values      = other.m_values;
+        this->m_index       = other.m_index;
+        this->m_size        = other.m_size;
+        this->m_indexSize   = other.m_indexSize;
+        this->m_indexStride = other.m_indexStride;
+        this->m_lessComp    = std::move(other.m_lessComp);
+        this->m_equalComp   = std::move(other.m_equalComp);
+
+        other.m_mapping = nullptr;
+        other.Close();
+
+        return *this;
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    MappedMap<typeK, typeV, lessComparator, equalComparator>::~MappedMap()
+    {
+        this->Close();
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    void MappedMap<typeK, typeV, lessComparator, equalComparator>::Close()
+    {
+        if (this->m_mapping != nullptr)
+            munmap(this->m_mapping, this->m_length);
+
+        this->m_mapping     = nullptr;
+        this->m_length      = 0;
+        this->m_keys        = nullptr;
+        this->m_values      = nullptr;
+        this->m_index       = nullptr;
+        this->m_size        = 0;
+        this->m_indexSize   = 0;
+        this->m_indexStride = 0;
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    std::size_t MappedMap<typeK, typeV, lessComparator, equalComparator>::LowerBound(
+        const typeK& key) const
+    {
+        std::size_t first = 0;
+        std::size_t last  = this->m_size;
+
+        // Narrow the search to one page of keys using the sparse index. Index entry
+        // i is the key at position i * m_indexStride
+        if (this->m_index != nullptr)
+        {
+            std::size_t low  = 0;
+            std::size_t high = this->m_indexSize;
+
+            // Find the first index entry greater than 'key'
+            while (low < high)
+            {
+                std::size_t middle = low + (high - low) / 2;
+
+                if (this->m_lessComp(key, this->m_index[middle]))
+                    high = middle;
+                else
+                    low = middle + 1;
+            }
+
+            // The header check keeps the entries inside the keys, but a file whose
+            // index does not match its keys must still not read past them
+            if (low > 0)
+                first = std::min((low - 1) * this->m_indexStride, this->m_size);
+
+            if (low < this->m_indexSize)
+                last = std::min(low * this->m_indexStride, this->m_size);
+
+            if (first > last)
+                first = last;
+        }
+
+        while (first < last)
+        {
+            std::size_t middle = first + (last - first) / 2;
+
+            if (this->m_lessComp(this->m_keys[middle], key))
+                first = middle + 1;
+            else
+                last = middle;
+        }
+
+        return first;
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    std::size_t MappedMap<typeK, typeV, lessComparator, equalComparator>::Size() const
+    {
+        return this->m_size;
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    bool MappedMap<typeK, typeV, lessComparator, equalComparator>::IsEmpty() const
+    {
+        return this->m_size == 0;
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    const typeV& MappedMap<typeK, typeV, lessComparator, equalComparator>::Get(
+        const typeK& key) const
+    {
+        const typeV* value = this->Search(key);
+
+        if (value == nullptr)
+            throw std::out_of_range("Key not found in the map");
+
+        return *value;
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    const typeV* MappedMap<typeK, typeV, lessComparator, equalComparator>::Search(
+        const typeK& key) const
+    {
+        std::size_t position = this->LowerBound(key);
+
+        if (position == this->m_size or
+            not this->m_equalComp(this->m_keys[position], key))
+            return nullptr;
+
+        return &this->m_values[position];
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    bool MappedMap<typeK, typeV, lessComparator, equalComparator>::Contains(
+        const typeK& key) const
+    {
+        return this->Search(key) != nullptr;
+    }
+
+    template<typename typeK,
+             typename typeV,
+             typename lessComparator,
+             typename equalComparator>
+    template<typename Function>
+    void MappedMap<typeK, typeV, lessComparator, equalComparator>::Range(
+        const typeK& low,
+        const typeK& high,
+        Function     function) const
+    {
+        for (std::size_t i = this->LowerBound(low);
+             i < this->m_size and not this->m_lessComp(high, this->m_keys[i]);
+             i++)
+        {
+            function(this->m_keys[i], this->m_values[i]);
+        }
+    }
+
+} // namespace rbtree
+
+#endif // MAPPED_MAP_H_
@@ -0,0 +1,544 @@
+/*
+ * Filename: min_max_heap.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef MIN_MAX_HEAP_H_
+#define MIN_MAX_HEAP_H_
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "comparators.h"
+#include "vector.h"
+
+// Binary heap namespace
+namespace bheap
+{
+    /**
+     * @brief Implementation of a min-max heap: a double-ended priority queue that
+     * gives both the first and the last element in comparator order
+     *
+     * The heap is a complete binary tree over a Vector whose levels alternate. A node
+     * on an even level (the root is on level 0) precedes every node below it, and a
+     * node on an odd level follows every node below it. The first element is then
+     * the root and the last one is the later of the root's children. Sifts compare a
+     * node with its grandchildren or grandparent, so both ends cost O(log n) and no
+     * second heap with cross-deletion is needed
+     *
+     * "Min" and "Max" follow the comparator: with the default comparator, PeekMin is
+     * the smallest element, and with 'comparators::Greater<typeT>' it is the largest.
+     * A bounded heap keeps at most a given number of elements: pushing into a full
+     * heap evicts the max element, or rejects the new one if it would be the max, so
+     * the heap keeps the elements that come first, like TopK
+     *
+     * Worst-case time complexities:
+     *   - Push, PopMin, PopMax: O(log n)
+     *   - PeekMin, PeekMax: O(1)
+     *   - Build from a range: O(n)
+     *
+     * @tparam typeT The type of elements stored in the heap
+     * @tparam Compare The custom comparator that defines the order of elements
+     *
+     * NOTE: By default, the 'Compare' parameter is set to 'comparators::Less<typeT>'
+     */
+    template<typename typeT, typename Compare = decltype(comparators::Less<typeT>)>
+    class MinMaxHeap
+    {
+        private:
+            Vector<typeT> m_heap;
+            std::size_t   m_capacity; // Maximum number of elements, 0 if unbounded
+            Compare       m_comp;     // Custom comparator
+
+            /**
+             * @brief Check if 'a' goes before 'b' on the given side of the heap: in
+             * comparator order on min levels, in reverse order on max levels
+             */
+            template<bool maxLevel>
+            bool Precedes(const typeT& a, const typeT& b) const;
+
+            /**
+             * @brief Check if a node is on a max level
+             */
+            static bool IsMaxLevel(std::size_t index);
+
+            /**
+             * @return Index of the max element. Requires a non-empty heap
+             */
+            std::size_t MaxIndex() const;
+
+            /**
+             * @brief Move the element at 'index' down until it fits the levels below
+             * @param index Index of the element
+             */
+            void HeapifyDown(std::size_t index);
+
+            template<bool maxLevel>
+            void HeapifyDown(std::size_t index);
+
+            /**
+             * @brief Move the element at 'index' up until it fits the levels above
+             * @param index Index of the element
+             */
+            void HeapifyUp(std::size_t index);
+
+            template<bool maxLevel>
+            void HeapifyUp(std::size_t index);
+
+            /**
+             * @brief Rebuild the heap property over all elements in O(n)
+             */
+            void Heapify();
+
+            /**
+             * @brief Put an element in place of the max element, which is dropped.
+             * The element must precede the max element
+             * @param index Index of the max element
+             * @param element The new element
+             */
+            void ReplaceMax(std::size_t index, typeT element);
+
+        public:
+            /**
+             * @brief Constructor for an unbounded MinMaxHeap
+             * @param comp The custom comparator to use (default is the standard
+             * comparator)
+             */
+            MinMaxHeap(const Compare& comp = Compare());
+
+            /**
+             * @brief Constructor for a bounded MinMaxHeap
+             * @param capacity The maximum number of elements
+             * @param comp The custom comparator to use (default is the standard
+             * comparator)
+             * @throw std::invalid_argument If capacity is zero
+             */
+            MinMaxHeap(std::size_t capacity, const Compare& comp = Compare());
+
+            /**
+             * @brief Constructor for an unbounded MinMaxHeap that builds the heap
+             * from a range of elements in O(n)
+             * @param first, last The range of elements
+             * @param comp The custom comparator to use (default is the standard
+             * comparator)
+             */
+            template<typename iterator>
+            MinMaxHeap(iterator first, iterator last, const Compare& comp = Compare());
+
+            ~MinMaxHeap();
+
+            /**
+             * @brief Insert a new element into the heap. If the heap is bounded and
+             * full, the max element is evicted, unless the new element does not
+             * precede it, in which case the new element is rejected
+             * @param element New element
+             * @return True if the element was kept, False if it was rejected
+             **/
+            bool Push(typeT element);
+
+            /**
+             * @brief Insert a new element like Push and report which element left
+             * the heap, if any
+             * @param element New element
+             * @param evicted Receives the evicted element, or the new element if it
+             * was rejected. Untouched if no element left
+             * @return True if an element left the heap, False otherwise
+             **/
+            bool Push(typeT element, typeT& evicted);
+
+            /**
+             * @brief Get the first element in comparator order
+             * @throw std::overflow_error If heap is empty
+             **/
+            const typeT& PeekMin() const;
+
+            /**
+             * @brief Get the last element in comparator order
+             * @throw std::overflow_error If heap is empty
+             **/
+            const typeT& PeekMax() const;
+
+            /**
+             * @brief Remove and return the first element in comparator order
+             * @throw std::underflow_error If heap is empty
+             **/
+            typeT PopMin();
+
+            /**
+             * @brief Remove and return the last element in comparator order
+             * @throw std::underflow_error If heap is empty
+             **/
+            typeT PopMax();
+
+            /**
+             * @brief Check if the heap is empty
+             * @return True if it is empty, False otherwise
+             **/
+            bool IsEmpty() const;
+
+            /**
+             * @brief Check if a bounded heap holds its maximum number of elements
+             * @return True if it does, False otherwise or if the heap is unbounded
+             **/
+            bool IsFull() const;
+
+            /**
+             * @brief Get the current size of the heap
+             * @return The current size of the heap
+             **/
+            std::size_t Size() const;
+
+            /**
+             * @return The maximum number of elements, or 0 if the heap is unbounded
+             **/
+            std::size_t Capacity() const;
+
+            /**
+             * @brief Delete all elements in the heap
+             **/
+            void Clear();
+    };
+
+    template<typename typeT, typename Compare>
+    MinMaxHeap<typeT, Compare>::MinMaxHeap(const Compare& comp)
+        : m_capacity(0),
+          m_comp(comp)
+    { }
+
+    template<typename typeT, typename Compare>
+    MinMaxHeap<typeT, Compare>::MinMaxHeap(std::size_t capacity, const Compare& comp)
+        : m_heap(capacity),
+          m_capacity(capacity),
+          m_comp(comp)
+    {
+        if (capacity == 0)
+            throw std::invalid_argument(
+                "MinMaxHeap needs room for at least one element");
+    }
+
+    template<typename typeT, typename Compare>
+    template<typename iterator>
+    MinMaxHeap<typeT, Compare>::MinMaxHeap(iterator       first,
+                                           iterator       last,
+                                           const Compare& comp)
+        : m_capacity(0),
+          m_comp(comp)
+    {
+        if constexpr (std::forward_iterator<iterator>)
+            this->m_heap.Reserve(static_cast<std::size_t>(std::distance(first, last)));
+
+        for (; first != last; ++first)
+            this->m_heap.PushBack(*first);
+
+        this->Heapify();
+    }
+
+    template<typename typeT, typename Compare>
+    MinMaxHeap<typeT, Compare>::~MinMaxHeap()
+    { }
+
+    template<typename typeT, typename Compare>
+    bool MinMaxHeap<typeT, Compare>::Push(typeT element)
+    {
+        if (not this->IsFull())
+        {
+            this->m_heap.PushBack(std::move(element));
+            this->HeapifyUp(this->m_heap.Size() - 1);
+            return true;
+        }
+
+        std::size_t index = this->MaxIndex();
+
+        // Fast reject: not before the max element
+        if (not this->m_comp(element, this->m_heap[index]))
+            return false;
+
+        this->ReplaceMax(index, std::move(element));
+        return true;
+    }
+
+    template<typename typeT, typename Compare>
+    bool MinMaxHeap<typeT, Compare>::Push(typeT element, typeT& evicted)
+    {
+        if (not this->IsFull())
+        {
+            this->m_heap.PushBack(std::move(element));
+            this->HeapifyUp(this->m_heap.Size() - 1);
+            return false;
+        }
+
+        std::size_t index = this->MaxIndex();
+
+        if (not this->m_comp(element, this->m_heap[index]))
+        {
+            evicted = std::move(element);
+            return true;
+        }
+
+        evicted = std::move(this->m_heap[index]);
+        this->ReplaceMax(index, std::move(element));
+        return true;
+    }
+
+    template<typename typeT, typename Compare>
+    const typeT& MinMaxHeap<typeT, Compare>::PeekMin() const
+    {
+        if (this->m_heap.IsEmpty())
+            throw std::overflow_error("Heap is empty!");
+
+        return this->m_heap[0];
+    }
+
+    template<typename typeT, typename Compare>
+    const typeT& MinMaxHeap<typeT, Compare>::PeekMax() const
+    {
+        if (this->m_heap.IsEmpty())
+            throw std::overflow_error("Heap is empty!");
+
+        return this->m_heap[this->MaxIndex()];
+    }
+
+    template<typename typeT, typename Compare>
+    typeT MinMaxHeap<typeT, Compare>::PopMin()
+    {
+        if (this->m_heap.IsEmpty())
+            throw std::underflow_error("Heap is empty!");
+
+        typeT toPop = std::move(this->m_heap[0]);
+        typeT last  = std::move(this->m_heap[this->m_heap.Size() - 1]);
+
+        this->m_heap.PopBack();
+
+        if (not this->m_heap.IsEmpty())
+        {
+            this->m_heap[0] = std::move(last);
+            this->HeapifyDown<false>(0);
+        }
+
+        return toPop;
+    }
+
+    template<typename typeT, typename Compare>
+    typeT MinMaxHeap<typeT, Compare>::PopMax()
+    {
+        if (this->m_heap.IsEmpty())
+            throw std::underflow_error("Heap is empty!");
+
+        std::size_t index = this->MaxIndex();
+        typeT       toPop = std::move(this->m_heap[index]);
+        typeT       last  = std::move(this->m_heap[this->m_heap.Size() - 1]);
+
+        this->m_heap.PopBack();
+
+        if (index < this->m_heap.Size())
+        {
+            this->m_heap[index] = std::move(last);
+            this->HeapifyDown<true>(index);
+        }
+
+        return toPop;
+    }
+
+    template<typename typeT, typename Compare>
+    bool MinMaxHeap<typeT, Compare>::IsEmpty() const
+    {
+        return this->m_heap.IsEmpty();
+    }
+
+    template<typename typeT, typename Compare>
+    bool MinMaxHeap<typeT, Compare>::IsFull() const
+    {
+        return this->m_capacity != 0 and this->m_heap.Size() == this->m_capacity;
+    }
+
+    template<typename typeT, typename Compare>
+    std::size_t MinMaxHeap<typeT, Compare>::Size() const
+    {
+        return this->m_heap.Size();
+    }
+
+    template<typename typeT, typename Compare>
+    std::size_t MinMaxHeap<typeT, Compare>::Capacity() const
+    {
+        return this->m_capacity;
+    }
+
+    template<typename typeT, typename Compare>
+    void MinMaxHeap<typeT, Compare>::Clear()
+    {
+        this->m_heap.Clear();
+    }
+
+    template<typename typeT, typename Compare>
+    template<bool maxLevel>
+    bool MinMaxHeap<typeT, Compare>::Precedes(const typeT& a, const typeT& b) const
+    {
+        if constexpr (maxLevel)
+            return this->m_comp(b, a);
+        else
+            return this->m_comp(a, b);
+    }
+
+    template<typename typeT, typename Compare>
+    bool MinMaxHeap<typeT, Compare>::IsMaxLevel(std::size_t index)
+    {
+        // Level of a node is floor(log2(index + 1))
+        return std::bit_width(index + 1) % 2 == 0;
+    }
+
+    template<typename typeT, typename Compare>
+    std::size_t MinMaxHeap<typeT, Compare>::MaxIndex() const
+    {
+        std::size_t size = this->m_heap.Size();
+
+        if (size < 3)
+            return size - 1;
+
+        return this->m_comp(this->m_heap[1], this->m_heap[2]) ? 2 : 1;
+    }
+
+    template<typename typeT, typename Compare>
+    void MinMaxHeap<typeT, Compare>::HeapifyDown(std::size_t index)
+    {
+        if (IsMaxLevel(index))
+            this->HeapifyDown<true>(index);
+        else
+            this->HeapifyDown<false>(index);
+    }
+
+    template<typename typeT, typename Compare>
+    template<bool maxLevel>
+    void MinMaxHeap<typeT, Compare>::HeapifyDown(std::size_t index)
+    {
+        std::size_t size  = this->m_heap.Size();
+        typeT       value = std::move(this->m_heap[index]);
+
+        while (2 * index + 1 < size)
+        {
+            // The first among the children and grandchildren, on this side
+            std::size_t best = 2 * index + 1;
+
+            if (best + 1 < size and
+                this->Precedes<maxLevel>(this->m_heap[best + 1], this->m_heap[best]))
+                best++;
+
+            std::size_t grandchild = 4 * index + 3;
+            std::size_t last       = std::min(grandchild + 4, size);
+
+            for (; grandchild < last; grandchild++)
+                if (this->Precedes<maxLevel>(this->m_heap[grandchild],
+                                             this->m_heap[best]))
+                    best = grandchild;
+
+            if (not this->Precedes<maxLevel>(this->m_heap[best], value))
+                break;
+
+            bool child = best <= 2 * index + 2;
+
+            this->m_heap[index] = std::move(this->m_heap[best]);
+            index               = best;
+
+            // A child has no grandchildren to continue with
+            if (child)
+                break;
+
+            // The parent of a grandchild is on the other side. If the value does not
+            // fit there, they swap, and the parent's element goes on down instead
+            std::size_t parent = (best - 1) / 2;
+
+            if (this->Precedes<maxLevel>(this->m_heap[parent], value))
+                std::swap(this->m_heap[parent], value);
+        }
+
+        this->m_heap[index] = std::move(value);
+    }
+
+    template<typename typeT, typename Compare>
+    void MinMaxHeap<typeT, Compare>::HeapifyUp(std::size_t index)
+    {
+        if (index == 0)
+            return;
+
+        std::size_t parent = (index - 1) / 2;
+
+        // The parent is on the other side. If the element belongs there, it takes
+        // the parent's place and goes on up that side
+        if (IsMaxLevel(index))
+        {
+            if (this->m_comp(this->m_heap[index], this->m_heap[parent]))
+            {
+                std::swap(this->m_heap[index], this->m_heap[parent]);
+                this->HeapifyUp<false>(parent);
+            }
+            else
+                this->HeapifyUp<true>(index);
+        }
+        else
+        {
+            if (this->m_comp(this->m_heap[parent], this->m_heap[index]))
+            {
+                std::swap(this->m_heap[index], this->m_heap[parent]);
+                this->HeapifyUp<true>(parent);
+            }
+            else
+                this->HeapifyUp<false>(index);
+        }
+    }
+
+    template<typename typeT, typename Compare>
+    template<bool maxLevel>
+    void MinMaxHeap<typeT, Compare>::HeapifyUp(std::size_t index)
+    {
+        typeT value = std::move(this->m_heap[index]);
+
+        while (index > 2)
+        {
+            std::size_t grandparent = ((index - 1) / 2 - 1) / 2;
+
+            if (not this->Precedes<maxLevel>(value, this->m_heap[grandparent]))
+                break;
+
+            this->m_heap[index] = std::move(this->m_heap[grandparent]);
+            index               = grandparent;
+        }
+
+        this->m_heap[index] = std::move(value);
+    }
+
+    template<typename typeT, typename Compare>
+    void MinMaxHeap<typeT, Compare>::Heapify()
+    {
+        for (std::size_t i = this->m_heap.Size() / 2; i > 0; i--)
+            this->HeapifyDown(i - 1);
+    }
+
+    template<typename typeT, typename Compare>
+    void MinMaxHeap<typeT, Compare>::ReplaceMax(std::size_t index, typeT element)
+    {
+        // The max element is the root only in a heap of one element
+        if (index == 0)
+        {
+            this->m_heap[0] = std::move(element);
+            return;
+        }
+
+        // The new element may precede the root. Then it becomes the root, and the
+        // old root, which precedes everything, sinks from the max level instead
+        if (this->m_comp(element, this->m_heap[0]))
+        {
+            this->m_heap[index] = std::move(this->m_heap[0]);
+            this->m_heap[0]     = std::move(element);
+        }
+        else
+            this->m_heap[index] = std::move(element);
+
+        this->HeapifyDown<true>(index);
+    }
+} // namespace bheap
+
+#endif // MIN_MAX_HEAP_H_
@@ -0,0 +1,236 @@
+/*
+ * Filename: multiset.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef MULTISET_H_
+#define MULTISET_H_
+
+#include <cstddef>
+
+#include "comparators.h"
+#include "node_rbtree.h"
+#include "pair.h"
+#include "red_black_tree.h"
+
+namespace rbtree
+{
+    /**
+     * @brief A multiset that keeps one node per distinct key with the number of
+     * copies of that key
+     *
+     * Copies of a key cost nothing beyond their counter, so duplicate-heavy data
+     * takes one tree node per distinct key. When the copies carry different values,
+     * Map::InsertMulti keeps them as separate nodes instead
+     *
+     * Time Complexity:
+     *   Function       Worst case
+     *    insert         O(log n)
+     *    count          O(log n)
+     *    remove         O(log n)
+     *
+     * Space Complexity: O(d), where d is the number of distinct keys
+     *
+     * @tparam typeT The type of the keys
+     * @tparam nodeT The node layout used by the underlying tree
+     */
+    template<typename typeT, template<typename> class nodeT = Node>
+    class MultiSet
+        : private RedBlackTree<Pair<typeT, std::size_t>,
+                               decltype(comparators::PairLess<typeT, std::size_t>),
+                               decltype(comparators::PairEqual<typeT, std::size_t>),
+                               nodeT>
+    {
+        private:
+            using RBTree =
+                RedBlackTree<Pair<typeT, std::size_t>,
+                             decltype(comparators::PairLess<typeT, std::size_t>),
+                             decltype(comparators::PairEqual<typeT, std::size_t>),
+                             nodeT>;
+
+            using NodeType = nodeT<Pair<typeT, std::size_t>>;
+
+            std::size_t m_copies; // Total number of copies of every key
+
+            /**
+             * @param key The key used in the search
+             * @return The node of the key, or nullptr if it is not in the multiset
+             */
+            NodeType* Find(const typeT& key);
+
+        public:
+            MultiSet();
+
+            /**
+             * @brief Add copies of a key
+             * @param key The key to be added
+             * @param copies Number of copies to be added
+             */
+            void Insert(const typeT& key, std::size_t copies = 1);
+
+            /**
+             * @param key The key to be counted
+             * @return The number of copies of the key
+             */
+            std::size_t Count(const typeT& key);
+
+            /**
+             * @return True if the key has at least one copy, False otherwise
+             */
+            bool Contains(const typeT& key);
+
+            /**
+             * @brief Remove one copy of a key. The node of the key is deleted with its
+             * last copy
+             * @param key The key to be removed
+             * @return True if a copy was removed, False if the key was not found
+             */
+            bool Remove(const typeT& key);
+
+            /**
+             * @brief Remove every copy of a key
+             * @param key The key to be removed
+             * @return The number of removed copies
+             */
+            std::size_t RemoveAll(const typeT& key);
+
+            /**
+             * @return The number of copies of every key
+             */
+            std::size_t Size() const;
+
+            /**
+             * @return The number of distinct keys
+             */
+            std::size_t DistinctSize() const;
+
+            /**
+             * @return True if it's empty, False otherwise
+             */
+            bool IsEmpty() const;
+
+            /**
+             * @brief Remove every key
+             */
+            void Clear();
+
+            /**
+             * @brief Call a function for each distinct key in ascending order
+             * @param f Function called as f(key, copies)
+             */
+            template<typename function>
+            void ForEach(function f);
+    };
+
+    template<typename typeT, template<typename> class nodeT>
+    MultiSet<typeT, nodeT>::MultiSet()
+        : RBTree(),
+          m_copies(0)
+    { }
+
+    template<typename typeT, template<typename> class nodeT>
+    nodeT<Pair<typeT, std::size_t>>* MultiSet<typeT, nodeT>::Find(const typeT& key)
+    {
+        return RBTree::Search(Pair<typeT, std::size_t>(key, 0));
+    }
+
+    template<typename typeT, template<typename> class nodeT>
+    void MultiSet<typeT, nodeT>::Insert(const typeT& key, std::size_t copies)
+    {
+        if (copies == 0)
+            return;
+
+        // Insert returns the node that already had the key, if any
+        NodeType* node = RBTree::Insert(Pair<typeT, std::size_t>(key, 0));
+
+        node->GetValue().GetSecond() += copies;
+        this->m_copies += copies;
+    }
+
+    template<typename typeT, template<typename> class nodeT>
+    std::size_t MultiSet<typeT, nodeT>::Count(const typeT& key)
+    {
+        NodeType* node = this->Find(key);
+
+        return node == nullptr ? 0 : node->GetValue().GetSecond();
+    }
+
+    template<typename typeT, template<typename> class nodeT>
+    bool MultiSet<typeT, nodeT>::Contains(const typeT& key)
+    {
+        return this->Find(key) != nullptr;
+    }
+
+    template<typename typeT, template<typename> class nodeT>
+    bool MultiSet<typeT, nodeT>::Remove(const typeT& key)
+    {
+        NodeType* node = this->Find(key);
+
+        if (node == nullptr)
+            return false;
+
+        this->m_copies--;
+
+        if (--node->GetValue().GetSecond() == 0)
+            RBTree::DeleteNode(node);
+
+        return true;
+    }
+
+    template<typename typeT, template<typename> class nodeT>
+    std::size_t MultiSet<typeT, nodeT>::RemoveAll(const typeT& key)
+    {
+        NodeType* node = this->Find(key);
+
+        if (node == nullptr)
+            return 0;
+
+        std::size_t copies = node->GetValue().GetSecond();
+
+        this->m_copies -= copies;
+        RBTree::DeleteNode(node);
+
+        return copies;
+    }
+
+    template<typename typeT, template<typename> class nodeT>
+    std::size_t MultiSet<typeT, nodeT>::Size() const
+    {
+        return this->m_copies;
+    }
+
+    template<typename typeT, template<typename> class nodeT>
+    std::size_t MultiSet<typeT, nodeT>::DistinctSize() const
+    {
+        return RBTree::Size();
+    }
+
+    template<typename typeT, template<typename> class nodeT>
+    bool MultiSet<typeT, nodeT>::IsEmpty() const
+    {
+        return this->m_copies == 0;
+    }
+
+    template<typename typeT, template<typename> class nodeT>
+    void MultiSet<typeT, nodeT>::Clear()
+    {
+        RBTree::Clear();
+        this->m_copies = 0;
+    }
+
+    template<typename typeT, template<typename> class nodeT>
+    template<typename function>
+    void MultiSet<typeT, nodeT>::ForEach(function f)
+    {
+        NodeType* node = this->m_root;
+
+        while (node != nullptr and node->GetLeftNode() != nullptr)
+            node = node->GetLeftNode();
+
+        for (; node != nullptr; node = this->FindSuccessor(node))
+            f(node->GetValue().GetFirst(), node->GetValue().GetSecond());
+    }
+} // namespace rbtree
+
+#endif // MULTISET_H_
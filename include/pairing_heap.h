@@ -0,0 +1,545 @@
+/*
+ * Filename: pairing_heap.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef PAIRING_HEAP_H_
+#define PAIRING_HEAP_H_
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "comparators.h"
+
+namespace bheap
+{
+    /**
+     * @brief Node of a PairingHeap. Each node points to its leftmost child and to
+     * its right sibling. 'prev' points to the left sibling, or to the parent for a
+     * leftmost child, so a node can be cut out of the heap in O(1)
+     */
+    template<typename typeT>
+    struct PairingNode
+    {
+        typeT               value;
+        PairingNode<typeT>* child;
+        PairingNode<typeT>* sibling;
+        PairingNode<typeT>* prev;
+    };
+
+    /**
+     * @brief Implementation of a pairing heap: a heap-ordered multiway tree where
+     * every operation is a sequence of links of two trees
+     *
+     * Two heaps are melded by a single link, and an element whose priority improves
+     * is cut out with its subtree and linked back to the root. The work is deferred
+     * to Pop, which links the children of the root in pairs from left to right and
+     * then links the pairs from right to left
+     *
+     * Nodes come from a pool owned by the heap. Freed nodes are reused, and memory
+     * goes back to the system when the heap is cleared or destroyed. Meld takes the
+     * pool of the other heap along with its nodes, so handles stay valid
+     *
+     * Time complexities:
+     *   - Push, Peek: O(1)
+     *   - Meld: one link, plus moving the chunk list of the pool
+     *   - DecreaseKey: O(1) worst case, o(log n) amortized
+     *   - Pop, Erase: O(log n) amortized
+     *
+     * @tparam typeT The type of elements stored in the heap
+     * @tparam Compare The custom comparator used to maintain the heap property
+     *
+     * NOTE: By default, the 'Compare' parameter is set to 'comparators::Less<typeT>'
+     * for a minimum heap
+     */
+    template<typename typeT, typename Compare = decltype(comparators::Less<typeT>)>
+    class PairingHeap
+    {
+        public:
+            // Identifies an element while it is in the heap
+            using Handle = PairingNode<typeT>*;
+
+        private:
+            using NodeType = PairingNode<typeT>;
+
+            // Pool slot. The union leaves the node unconstructed until the slot is
+            // allocated, and its first member links the slot into the free list
+            union Slot
+            {
+                Slot*    next;
+                NodeType node;
+
+                Slot() { }
+
+                ~Slot() { }
+            };
+
+            static constexpr std::size_t FIRST_CHUNK_SIZE = 64;
+            static constexpr std::size_t MAX_CHUNK_SIZE   = 65536;
+
+            NodeType*   m_root;
+            std::size_t m_size;
+            Compare     m_comp; // Custom comparator
+
+            // Slots are allocated in chunks of growing size. Slots are taken from
+            // the free list first and then from the last chunk
+            std::vector<std::unique_ptr<Slot[]>> m_chunks;
+            std::size_t                          m_chunkSize;
+            std::size_t                          m_chunkUsed;
+            Slot*                                m_freeHead;
+            Slot*                                m_freeTail;
+
+            /**
+             * @brief Construct a node in a slot of the pool
+             * @param element Value of the node
+             * @return The new node
+             */
+            NodeType* NewNode(typeT element);
+
+            /**
+             * @brief Destroy a node and return its slot to the free list
+             * @param node The node to be freed
+             */
+            void FreeNode(NodeType* node);
+
+            /**
+             * @brief Link two roots: the one that comes second becomes the leftmost
+             * child of the other
+             * @return The root of the linked tree
+             */
+            NodeType* Link(NodeType* a, NodeType* b);
+
+            /**
+             * @brief Link a list of siblings into a single tree with the two-pass
+             * method
+             * @param first The leftmost sibling, or nullptr
+             * @return The root of the tree, or nullptr
+             */
+            NodeType* CombineSiblings(NodeType* first);
+
+            /**
+             * @brief Cut a node other than the root, together with its subtree, out
+             * of the heap
+             */
+            void Detach(NodeType* node);
+
+            /**
+             * @brief Remove the root, linking its children into the new root
+             * @return The old root, still to be freed
+             */
+            NodeType* RemoveRoot();
+
+        public:
+            /**
+             * @brief Constructor for PairingHeap
+             * @param comp The custom comparator to use (default is the standard
+             * comparator)
+             */
+            PairingHeap(const Compare& comp = Compare());
+
+            PairingHeap(const PairingHeap&)            = delete;
+            PairingHeap& operator=(const PairingHeap&) = delete;
+
+            ~PairingHeap();
+
+            /**
+             * @brief Insert a new element into the heap
+             * @param element New element
+             * @return The handle of the element, valid until it leaves the heap
+             **/
+            Handle Push(typeT element);
+
+            /**
+             * @brief Get the element with the priority value considered the lowest or
+             * highest without removing it
+             * @return The element with the lowest or highest priority value
+             * @throw std::overflow_error If heap is empty
+             **/
+            typeT Peek();
+
+            /**
+             * @brief Remove and return the element with the priority value considered
+             * the lowest or highest. Its handle becomes invalid
+             * @return The element with the lowest or highest priority value
+             * @throw std::underflow_error If heap is empty
+             **/
+            typeT Pop();
+
+            /**
+             * @brief Move every element of another heap into this one with a single
+             * link. The handles of the other heap stay valid and now belong to this
+             * heap
+             * @param other The heap to be melded, which becomes empty
+             **/
+            void Meld(PairingHeap& other);
+
+            /**
+             * @brief Get the element of a handle
+             * @param handle A handle of an element in this heap
+             **/
+            const typeT& Get(Handle handle) const;
+
+            /**
+             * @brief Give an element a value that does not come after its current
+             * one
+             * @param handle A handle of an element in this heap
+             * @param element The new value
+             * @throw std::invalid_argument If the new value comes after the current
+             * one
+             **/
+            void DecreaseKey(Handle handle, typeT element);
+
+            /**
+             * @brief Remove an element from the heap. Its handle becomes invalid
+             * @param handle A handle of an element in this heap
+             * @return The removed element
+             **/
+            typeT Erase(Handle handle);
+
+            /**
+             * @brief Check if the heap is empty
+             * @return True if it is empty, False otherwise
+             **/
+            bool IsEmpty();
+
+            /**
+             * @brief Get the current size of the heap
+             * @return The current size of the heap
+             **/
+            std::size_t Size();
+
+            /**
+             * @brief Delete all elements in the heap and release the pool. Every
+             * handle becomes invalid
+             **/
+            void Clear();
+    };
+
+    template<typename typeT, typename Compare>
+    PairingHeap<typeT, Compare>::PairingHeap(const Compare& comp)
+        : m_root(nullptr),
+          m_size(0),
+          m_comp(comp),
+          m_chunkSize(0),
+          m_chunkUsed(0),
+          m_freeHead(nullptr),
+          m_freeTail(nullptr)
+    { }
+
+    template<typename typeT, typename Compare>
+    PairingHeap<typeT, Compare>::~PairingHeap()
+    {
+        this->Clear();
+    }
+
+    template<typename typeT, typename Compare>
+    typename PairingHeap<typeT, Compare>::Handle
+    PairingHeap<typeT, Compare>::Push(typeT element)
+    {
+        NodeType* node = this->NewNode(std::move(element));
+
+        if (this->m_root == nullptr)
+            this->m_root = node;
+        else
+            this->m_root = this->Link(this->m_root, node);
+
+        this->m_size++;
+
+        return node;
+    }
+
+    template<typename typeT, typename Compare>
+    typeT PairingHeap<typeT, Compare>::Peek()
+    {
+        if (this->m_root == nullptr)
+            throw std::overflow_error("Heap is empty!");
+
+        return this->m_root->value;
+    }
+
+    template<typename typeT, typename Compare>
+    typeT PairingHeap<typeT, Compare>::Pop()
+    {
+        if (this->m_root == nullptr)
+            throw std::underflow_error("Heap is empty!");
+
+        NodeType* root  = this->RemoveRoot();
+        typeT     toPop = std::move(root->value);
+
+        this->FreeNode(root);
+        return toPop;
+    }
+
+    template<typename typeT, typename Compare>
+    void PairingHeap<typeT, Compare>::Meld(PairingHeap& other)
+    {
+        if (this == &other or other.m_root == nullptr)
+            return;
+
+        if (this->m_root == nullptr)
+            this->m_root = other.m_root;
+        else
+            this->m_root = this->Link(this->m_root, other.m_root);
+
+        this->m_size += other.m_size;
+
+        // The chunks of the other heap go before ours, so that our last chunk keeps
+        // handing out slots. The free slots left at the end of its last chunk are
+        // only reclaimed when this heap is cleared
+        this->m_chunks.insert(this->m_chunks.begin(),
+                              std::make_move_iterator(other.m_chunks.begin()),
+                              std::make_move_iterator(other.m_chunks.end()));
+
+        if (other.m_freeHead != nullptr)
+        {
+            other.m_freeTail->next = this->m_freeHead;
+            this->m_freeHead       = other.m_freeHead;
+
+            if (this->m_freeTail == nullptr)
+                this->m_freeTail = other.m_freeTail;
+        }
+
+        other.m_root      = nullptr;
+        other.m_size      = 0;
+        other.m_chunkSize = 0;
+        other.m_chunkUsed = 0;
+        other.m_freeHead  = nullptr;
+        other.m_freeTail  = nullptr;
+        other.m_chunks.clear();
+    }
+
+    template<typename typeT, typename Compare>
+    const typeT& PairingHeap<typeT, Compare>::Get(Handle handle) const
+    {
+        return handle->value;
+    }
+
+    template<typename typeT, typename Compare>
+    void PairingHeap<typeT, Compare>::DecreaseKey(Handle handle, typeT element)
+    {
+        if (this->m_comp(handle->value, element))
+            throw std::invalid_argument("New key comes after the current one");
+
+        handle->value = std::move(element);
+
+        if (handle == this->m_root)
+            return;
+
+        this->Detach(handle);
+        this->m_root = this->Link(this->m_root, handle);
+    }
+
+    template<typename typeT, typename Compare>
+    typeT PairingHeap<typeT, Compare>::Erase(Handle handle)
+    {
+        if (handle == this->m_root)
+            return this->Pop();
+
+        this->Detach(handle);
+
+        NodeType* subtree = this->CombineSiblings(handle->child);
+        typeT     erased  = std::move(handle->value);
+
+        if (subtree != nullptr)
+            this->m_root = this->Link(this->m_root, subtree);
+
+        this->m_size--;
+        this->FreeNode(handle);
+
+        return erased;
+    }
+
+    template<typename typeT, typename Compare>
+    bool PairingHeap<typeT, Compare>::IsEmpty()
+    {
+        return this->m_root == nullptr;
+    }
+
+    template<typename typeT, typename Compare>
+    std::size_t PairingHeap<typeT, Compare>::Size()
+    {
+        return this->m_size;
+    }
+
+    template<typename typeT, typename Compare>
+    void PairingHeap<typeT, Compare>::Clear()
+    {
+        // The tree can be much deeper than the call stack allows, so the nodes
+        // are visited with an explicit stack
+        std::vector<NodeType*> pending;
+
+        if (this->m_root != nullptr)
+            pending.push_back(this->m_root);
+
+        while (not pending.empty())
+        {
+            NodeType* node = pending.back();
+            pending.pop_back();
+
+            if (node->child != nullptr)
+                pending.push_back(node->child);
+
+            if (node->sibling != nullptr)
+                pending.push_back(node->sibling);
+
+            std::destroy_at(node);
+        }
+
+        this->m_root      = nullptr;
+        this->m_size      = 0;
+        this->m_chunkSize = 0;
+        this->m_chunkUsed = 0;
+        this->m_freeHead  = nullptr;
+        this->m_freeTail  = nullptr;
+        this->m_chunks.clear();
+    }
+
+    template<typename typeT, typename Compare>
+    typename PairingHeap<typeT, Compare>::NodeType*
+    PairingHeap<typeT, Compare>::NewNode(typeT element)
+    {
+        Slot* slot;
+
+        if (this->m_freeHead != nullptr)
+        {
+            slot             = this->m_freeHead;
+            this->m_freeHead = slot->next;
+
+            if (this->m_freeHead == nullptr)
+                this->m_freeTail = nullptr;
+        }
+        else
+        {
+            if (this->m_chunkUsed == this->m_chunkSize)
+            {
+                if (this->m_chunkSize == 0)
+                    this->m_chunkSize = FIRST_CHUNK_SIZE;
+                else if (this->m_chunkSize < MAX_CHUNK_SIZE)
+                    this->m_chunkSize *= 2;
+
+                this->m_chunkUsed = 0;
+                this->m_chunks.push_back(std::make_unique<Slot[]>(this->m_chunkSize));
+            }
+
+            slot = &this->m_chunks.back()[this->m_chunkUsed++];
+        }
+
+        return ::new (&slot->node)
+            NodeType { std::move(element), nullptr, nullptr, nullptr };
+    }
+
+    template<typename typeT, typename Compare>
+    void PairingHeap<typeT, Compare>::FreeNode(NodeType* node)
+    {
+        std::destroy_at(node);
+
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->next = this->m_freeHead;
+
+        if (this->m_freeHead == nullptr)
+            this->m_freeTail = slot;
+
+        this->m_freeHead = slot;
+    }
+
+    template<typename typeT, typename Compare>
+    typename PairingHeap<typeT, Compare>::NodeType*
+    PairingHeap<typeT, Compare>::Link(NodeType* a, NodeType* b)
+    {
+        if (this->m_comp(b->value, a->value))
+            std::swap(a, b);
+
+        b->sibling = a->child;
+        b->prev    = a;
+
+        if (a->child != nullptr)
+            a->child->prev = b;
+
+        a->child   = b;
+        a->sibling = nullptr;
+        a->prev    = nullptr;
+
+        return a;
+    }
+
+    template<typename typeT, typename Compare>
+    typename PairingHeap<typeT, Compare>::NodeType*
+    PairingHeap<typeT, Compare>::CombineSiblings(NodeType* first)
+    {
+        if (first == nullptr)
+            return nullptr;
+
+        // First pass: link the siblings in pairs from left to right. The results
+        // are chained through 'sibling' in reverse order, so the last pair is the
+        // head of the chain
+        NodeType* pairs = nullptr;
+
+        while (first != nullptr)
+        {
+            NodeType* a = first;
+            NodeType* b = a->sibling;
+
+            if (b == nullptr)
+            {
+                a->sibling = pairs;
+                pairs      = a;
+                break;
+            }
+
+            first = b->sibling;
+
+            NodeType* linked = this->Link(a, b);
+            linked->sibling  = pairs;
+            pairs            = linked;
+        }
+
+        // Second pass: link the pairs from right to left into a single tree
+        NodeType* root = pairs;
+        pairs          = pairs->sibling;
+
+        while (pairs != nullptr)
+        {
+            NodeType* next = pairs->sibling;
+            root           = this->Link(root, pairs);
+            pairs          = next;
+        }
+
+        root->sibling = nullptr;
+        root->prev    = nullptr;
+
+        return root;
+    }
+
+    template<typename typeT, typename Compare>
+    void PairingHeap<typeT, Compare>::Detach(NodeType* node)
+    {
+        if (node->prev->child == node)
+            node->prev->child = node->sibling;
+        else
+            node->prev->sibling = node->sibling;
+
+        if (node->sibling != nullptr)
+            node->sibling->prev = node->prev;
+
+        node->sibling = nullptr;
+        node->prev    = nullptr;
+    }
+
+    template<typename typeT, typename Compare>
+    typename PairingHeap<typeT, Compare>::NodeType*
+    PairingHeap<typeT, Compare>::RemoveRoot()
+    {
+        NodeType* root = this->m_root;
+
+        this->m_root = this->CombineSiblings(root->child);
+        this->m_size--;
+
+        return root;
+    }
+} // namespace bheap
+
+#endif // PAIRING_HEAP_H_
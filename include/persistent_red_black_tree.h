@@ -0,0 +1,968 @@
+/*
+ * Filename: persistent_red_black_tree.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef PERSISTENT_RED_BLACK_TREE_H_
+#define PERSISTENT_RED_BLACK_TREE_H_
+
+#include <atomic>
+#include <cstddef>
+
+#include "comparators.h"
+#include "node_rbtree.h"
+
+namespace rbtree
+{
+    /**
+     * @brief Reference counted node used by the persistent Red-Black Tree
+     *
+     * The node has no parent pointer, since a node may be shared by several versions
+     * of the tree. The reference count is the number of links (tree roots, snapshots
+     * or parent nodes) pointing to the node
+     */
+    template<typename typeT>
+    class PersistentNode
+    {
+        private:
+            PersistentNode<typeT>*   m_left;
+            PersistentNode<typeT>*   m_right;
+            std::atomic<std::size_t> m_refCount;
+
+        protected:
+            typeT m_value;
+            Color m_color;
+
+        public:
+            PersistentNode(const typeT value)
+                : m_left(nullptr),
+                  m_right(nullptr),
+                  m_refCount(1),
+                  m_value(value),
+                  m_color(RED)
+            { }
+
+            /**
+             * @brief Copy a node for path copying. The children are shared with the
+             * original node, so their reference counts are incremented
+             */
+            PersistentNode(const PersistentNode<typeT>& other)
+                : m_left(other.m_left),
+                  m_right(other.m_right),
+                  m_refCount(1),
+                  m_value(other.m_value),
+                  m_color(other.m_color)
+            {
+                if (this->m_left != nullptr)
+                    this->m_left->Acquire();
+
+                if (this->m_right != nullptr)
+                    this->m_right->Acquire();
+            }
+
+            /**
+             * @brief Add a new link to this node
+             */
+            void Acquire()
+            {
+                this->m_refCount.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Remove a link to this node
+             * @return True if it was the last link, False otherwise
+             */
+            bool Release()
+            {
+                return this->m_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+            }
+
+            /**
+             * @return True if only one link points to this node
+             */
+            bool IsUnique() const
+            {
+                return this->m_refCount.load(std::memory_order_acquire) == 1;
+            }
+
+            void SetColor(Color newColor)
+            {
+                this->m_color = newColor;
+            }
+
+            Color GetColor() const
+            {
+                return this->m_color;
+            }
+
+            /**
+             * @brief Sets the value of the node
+             * @param newValue The new value to be assigned to the node
+             */
+            void SetValue(const typeT& newValue)
+            {
+                this->m_value = newValue;
+            }
+
+            /**
+             * @brief Gets the value of the node
+             * @return The value of the node
+             */
+            const typeT& GetValue() const
+            {
+                return this->m_value;
+            }
+
+            /**
+             * @brief Sets the left child node of the current node
+             * @param lnode Pointer to the left child node to be set
+             */
+            void SetLeftNode(PersistentNode<typeT>* lnode)
+            {
+                this->m_left = lnode;
+            }
+
+            /**
+             * @brief Sets the right child node of the current node
+             * @param rnode Pointer to the right child node to be set
+             */
+            void SetRightNode(PersistentNode<typeT>* rnode)
+            {
+                this->m_right = rnode;
+            }
+
+            /**
+             * @brief Gets the left child node of the current node
+             * @return Pointer to the left child node
+             */
+            PersistentNode<typeT>* GetLeftNode() const
+            {
+                return this->m_left;
+            }
+
+            /**
+             * @brief Gets the right child node of the current node
+             * @return Pointer to the right child node
+             */
+            PersistentNode<typeT>* GetRightNode() const
+            {
+                return this->m_right;
+            }
+    };
+
+    /**
+     * @brief A persistent (path-copying) Red-Black Tree
+     *
+     * This class represents a left-leaning Red-Black Tree whose nodes are shared
+     * between versions through reference counts. Insert and Remove copy only the nodes
+     * on the root-to-leaf path that are shared with another version; nodes owned only
+     * by the current version are updated in place
+     *
+     * Snapshot() returns a read-only View of the current version in O(1). A snapshot
+     * stays valid and unchanged while the tree keeps being modified, and it can be
+     * read and released from another thread. The tree itself must be modified by a
+     * single writer at a time
+     *
+     * To use it as a map, store Pair<typeK, typeV> elements with the
+     * comparators::PairLess and comparators::PairEqual comparators
+     *
+     * Time Complexity:
+     *   Function       Worst case
+     *    insert         O(log n)
+     *    delete         O(log n)
+     *    search         O(log n)
+     *    snapshot       O(1)
+     *
+     * Space Complexity: O(n) plus O(log n) copied nodes per update while a snapshot
+     * shares the modified path
+     *
+     * @tparam typeT The type of elements stored in the Red-Black Tree
+     * @tparam lessComparator The custom comparator for less-than comparisons
+     * @tparam equalComparator The custom comparator for equal comparisons
+     */
+    template<typename typeT,
+             typename lessComparator  = decltype(comparators::Less<typeT>),
+             typename equalComparator = decltype(comparators::Equal<typeT>)>
+    class PersistentRedBlackTree
+    {
+        public:
+            using NodeType = PersistentNode<typeT>;
+
+            /**
+             * @brief Immutable point-in-time view of a PersistentRedBlackTree
+             */
+            class View
+            {
+                private:
+                    NodeType*   m_root;
+                    std::size_t m_numNodes;
+
+                    lessComparator  m_lessComp;
+                    equalComparator m_equalComp;
+
+                    friend class PersistentRedBlackTree;
+
+                    View(NodeType*              root,
+                         std::size_t            numNodes,
+                         const lessComparator&  lessComp,
+                         const equalComparator& equalComp);
+
+                    template<typename Function>
+                    void ForEach(NodeType* node, Function& fn) const;
+
+                public:
+                    View(const View& other);
+
+                    ~View();
+
+                    View& operator=(const View& other);
+
+                    /**
+                     * @brief Search for an element in the snapshot
+                     * @param key The key used in the search
+                     * @return Pointer to the element or nullptr if it was not found
+                     */
+                    const typeT* Search(const typeT& key) const;
+
+                    /**
+                     * @return True if the key is in the snapshot, False otherwise
+                     */
+                    bool Contains(const typeT& key) const;
+
+                    /**
+                     * @return Number of elements in the snapshot
+                     */
+                    std::size_t Size() const;
+
+                    /**
+                     * @return True if the snapshot is empty, False otherwise
+                     */
+                    bool IsEmpty() const;
+
+                    /**
+                     * @brief Call fn(element) for every element, in order
+                     */
+                    template<typename Function>
+                    void ForEach(Function fn) const;
+            };
+
+        protected:
+            NodeType*   m_root;     // Pointer to the root node
+            std::size_t m_numNodes; // Total number of nodes in the tree
+
+            // Custom comparators
+            lessComparator  m_lessComp;
+            equalComparator m_equalComp;
+
+            /**
+             * @brief Drop one link to a node, deleting it (and releasing its children)
+             * if it was the last one
+             * @param node The node to be released
+             */
+            static void Release(NodeType* node);
+
+            /**
+             * @brief Get a node that can be modified in place. If the node is shared
+             * with another version, it is copied and the link to the original node
+             * is released, so the caller must replace its link with the returned node
+             * @param node The node to be modified
+             * @return Pointer to a node owned only by the current version
+             */
+            NodeType* Mutable(NodeType* node);
+
+            /**
+             * @return True if the node is red, False otherwise (null nodes are black)
+             */
+            bool IsRed(NodeType* node) const;
+
+            /**
+             * @brief Insert a key into the subtree (recursive call)
+             * @param node The root of the current subtree
+             * @param key The key to be stored
+             * @param assign If True, replace an existing equal element
+             * @param inserted Set to True if a new node was created
+             * @return The new root of the subtree
+             */
+            NodeType* Insert(NodeType*    node,
+                             const typeT& key,
+                             bool         assign,
+                             bool&        inserted);
+
+            /**
+             * @brief Remove a key that is known to be in the subtree (recursive call)
+             * @param node The root of the current subtree
+             * @param key The key to be removed
+             * @return The new root of the subtree
+             */
+            NodeType* Remove(NodeType* node, const typeT& key);
+
+            /**
+             * @brief Remove the leftmost node of the subtree
+             * @param node The root of the current subtree
+             * @return The new root of the subtree
+             */
+            NodeType* RemoveMin(NodeType* node);
+
+            /**
+             * @brief Perform a left rotation
+             * @param node The node to be rotated
+             * @return Pointer to the node that takes the place of the rotated node
+             */
+            NodeType* RotateLeft(NodeType* node);
+
+            /**
+             * @brief Perform a right rotation
+             * @param node The node to be rotated
+             * @return Pointer to the node that takes the place of the rotated node
+             */
+            NodeType* RotateRight(NodeType* node);
+
+            /**
+             * @brief Invert the color of a node and its children
+             * @param node The node where the modification will occur
+             */
+            void ChangeFamilyColor(NodeType* node);
+
+            /**
+             * @brief Move a red node to the left
+             * @param node The node to be moved
+             * @return Pointer to the node that takes the place of the moved node
+             */
+            NodeType* MoveRed2Left(NodeType* node);
+
+            /**
+             * @brief Move a red node to the right
+             * @param node The node to be moved
+             * @return Pointer to the node that takes the place of the moved node
+             */
+            NodeType* MoveRed2Right(NodeType* node);
+
+            /**
+             * @brief Restore the left-leaning Red-Black properties on the way up
+             * @param node The root of the current subtree
+             * @return The new root of the subtree
+             */
+            NodeType* FixUp(NodeType* node);
+
+            /**
+             * @brief Search for the node containing a specific key
+             * @param node The root of the subtree
+             * @param key The key used in the search
+             * @return Pointer to the node or nullptr if the node was not found
+             */
+            NodeType* Search(NodeType* node, const typeT& key) const;
+
+        public:
+            PersistentRedBlackTree(const lessComparator&  lessComp  = lessComparator(),
+                                   const equalComparator& equalComp = equalComparator());
+
+            /**
+             * @brief Copy constructor. O(1): the new tree shares every node with the
+             * other tree until one of them is modified
+             */
+            PersistentRedBlackTree(const PersistentRedBlackTree& other);
+
+            ~PersistentRedBlackTree();
+
+            /**
+             * @brief Assignment operator. O(1), see the copy constructor
+             */
+            PersistentRedBlackTree& operator=(const PersistentRedBlackTree& other);
+
+            /**
+             * @brief Insert a new element. Equal elements are not replaced
+             * @param key Key to be stored in the Red-Black Tree
+             * @return True if the element was inserted, False if it was already there
+             */
+            bool Insert(const typeT& key);
+
+            /**
+             * @brief Insert a new element or replace the equal element
+             * @param key Key to be stored in the Red-Black Tree
+             * @return True if the element was inserted, False if it was replaced
+             */
+            bool InsertOrAssign(const typeT& key);
+
+            /**
+             * @brief Remove an element from the Red-Black Tree
+             * @param key Key of the element to be removed
+             */
+            void Remove(const typeT& key);
+
+            /**
+             * @brief Search for an element
+             * @param key The key used in the search
+             * @return Pointer to the element or nullptr if it was not found
+             */
+            const typeT* Search(const typeT& key) const;
+
+            /**
+             * @return True if the key is in the tree, False otherwise
+             */
+            bool Contains(const typeT& key) const;
+
+            /**
+             * @brief Get an immutable view of the current version in O(1)
+             * @return The snapshot
+             */
+            View Snapshot() const;
+
+            /**
+             * @brief Returns the number of elements in the Red-Black Tree
+             * @return Number of elements in the Red-Black Tree
+             */
+            std::size_t Size() const;
+
+            /**
+             * @brief Checks if the Red-Black Tree is empty
+             * @return True if it's empty, False otherwise
+             */
+            bool IsEmpty() const;
+
+            /**
+             * @brief Deletes the entire Red-Black Tree. Nodes shared with snapshots
+             * are kept alive by them
+             */
+            void Clear();
+    };
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::View::View(
+        NodeType*              root,
+        std::size_t            numNodes,
+        const lessComparator&  lessComp,
+        const equalComparator& equalComp)
+        : m_root(root),
+          m_numNodes(numNodes),
+          m_lessComp(lessComp),
+          m_equalComp(equalComp)
+    {
+        if (this->m_root != nullptr)
+            this->m_root->Acquire();
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::View::View(
+        const View& other)
+        : m_root(other.m_root),
+          m_numNodes(other.m_numNodes),
+          m_lessComp(other.m_lessComp),
+          m_equalComp(other.m_equalComp)
+    {
+        if (this->m_root != nullptr)
+            this->m_root->Acquire();
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::View::~View()
+    {
+        PersistentRedBlackTree::Release(this->m_root);
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    typename PersistentRedBlackTree<typeT, lessComparator, equalComparator>::View&
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::View::operator=(
+        const View& other)
+    {
+        if (this == &other)
+            return *this;
+
+        if (other.m_root != nullptr)
+            other.m_root->Acquire();
+
+        PersistentRedBlackTree::Release(this->m_root);
+
+        this->m_root      = other.m_root;
+        this->m_numNodes  = other.m_numNodes;
+        this->m_lessComp  = other.m_lessComp;
+        this->m_equalComp = other.m_equalComp;
+
+        return *this;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    const typeT*
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::View::Search(
+        const typeT& key) const
+    {
+        NodeType* node = this->m_root;
+
+        while (node != nullptr and not this->m_equalComp(key, node->GetValue()))
+        {
+            if (this->m_lessComp(key, node->GetValue()))
+                node = node->GetLeftNode();
+
+            else
+                node = node->GetRightNode();
+        }
+
+        return node == nullptr ? nullptr : &node->GetValue();
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    bool
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::View::Contains(
+        const typeT& key) const
+    {
+        return this->Search(key) != nullptr;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    std::size_t
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::View::Size() const
+    {
+        return this->m_numNodes;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    bool
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::View::IsEmpty()
+        const
+    {
+        return this->m_numNodes == 0;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    template<typename Function>
+    void PersistentRedBlackTree<typeT, lessComparator, equalComparator>::View::ForEach(
+        Function fn) const
+    {
+        this->ForEach(this->m_root, fn);
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    template<typename Function>
+    void PersistentRedBlackTree<typeT, lessComparator, equalComparator>::View::ForEach(
+        NodeType* node,
+        Function& fn) const
+    {
+        if (node == nullptr)
+            return;
+
+        this->ForEach(node->GetLeftNode(), fn);
+        fn(node->GetValue());
+        this->ForEach(node->GetRightNode(), fn);
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::PersistentRedBlackTree(
+        const lessComparator&  lessComp,
+        const equalComparator& equalComp)
+        : m_lessComp(lessComp),
+          m_equalComp(equalComp)
+    {
+        this->m_root     = nullptr;
+        this->m_numNodes = 0;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::PersistentRedBlackTree(
+        const PersistentRedBlackTree& other)
+        : m_root(other.m_root),
+          m_numNodes(other.m_numNodes),
+          m_lessComp(other.m_lessComp),
+          m_equalComp(other.m_equalComp)
+    {
+        if (this->m_root != nullptr)
+            this->m_root->Acquire();
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::
+        ~PersistentRedBlackTree()
+    {
+        this->Clear();
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>&
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::operator=(
+        const PersistentRedBlackTree& other)
+    {
+        if (this == &other)
+            return *this;
+
+        if (other.m_root != nullptr)
+            other.m_root->Acquire();
+
+        Release(this->m_root);
+
+        this->m_root      = other.m_root;
+        this->m_numNodes  = other.m_numNodes;
+        this->m_lessComp  = other.m_lessComp;
+        this->m_equalComp = other.m_equalComp;
+
+        return *this;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    void PersistentRedBlackTree<typeT, lessComparator, equalComparator>::Release(
+        NodeType* node)
+    {
+        if (node == nullptr or not node->Release())
+            return;
+
+        Release(node->GetLeftNode());
+        Release(node->GetRightNode());
+
+        delete node;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    typename PersistentRedBlackTree<typeT, lessComparator, equalComparator>::NodeType*
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::Mutable(
+        NodeType* node)
+    {
+        if (node == nullptr or node->IsUnique())
+            return node;
+
+        NodeType* copy = new NodeType(*node);
+        Release(node);
+
+        return copy;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    bool PersistentRedBlackTree<typeT, lessComparator, equalComparator>::IsRed(
+        NodeType* node) const
+    {
+        return node != nullptr and node->GetColor() == RED;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    bool PersistentRedBlackTree<typeT, lessComparator, equalComparator>::Insert(
+        const typeT& key)
+    {
+        bool inserted = false;
+
+        this->m_root = this->Insert(this->m_root, key, false, inserted);
+
+        // A root left red by FixUp is a fresh copy. When nothing changed, the
+        // root may be shared with other versions, so it is not written to
+        if (this->IsRed(this->m_root))
+            this->m_root->SetColor(BLACK);
+
+        return inserted;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    bool PersistentRedBlackTree<typeT, lessComparator, equalComparator>::InsertOrAssign(
+        const typeT& key)
+    {
+        bool inserted = false;
+
+        this->m_root = this->Insert(this->m_root, key, true, inserted);
+
+        // A root left red by FixUp is a fresh copy. When nothing changed, the
+        // root may be shared with other versions, so it is not written to
+        if (this->IsRed(this->m_root))
+            this->m_root->SetColor(BLACK);
+
+        return inserted;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    typename PersistentRedBlackTree<typeT, lessComparator, equalComparator>::NodeType*
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::Insert(
+        NodeType*    node,
+        const typeT& key,
+        bool         assign,
+        bool&        inserted)
+    {
+        if (node == nullptr)
+        {
+            this->m_numNodes++;
+            inserted = true;
+            return new NodeType(key);
+        }
+
+        if (this->m_equalComp(key, node->GetValue()))
+        {
+            // Nothing changes, so the shared path doesn't need to be copied
+            if (not assign)
+                return node;
+
+            node = this->Mutable(node);
+            node->SetValue(key);
+            return node;
+        }
+
+        node = this->Mutable(node);
+
+        if (this->m_lessComp(key, node->GetValue()))
+            node->SetLeftNode(this->Insert(node->GetLeftNode(), key, assign, inserted));
+
+        else
+            node->SetRightNode(
+                this->Insert(node->GetRightNode(), key, assign, inserted));
+
+        return this->FixUp(node);
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    void PersistentRedBlackTree<typeT, lessComparator, equalComparator>::Remove(
+        const typeT& key)
+    {
+        if (not this->Contains(key))
+            return;
+
+        this->m_root = this->Mutable(this->m_root);
+
+        if (not this->IsRed(this->m_root->GetLeftNode()) and
+            not this->IsRed(this->m_root->GetRightNode()))
+            this->m_root->SetColor(RED);
+
+        this->m_root = this->Remove(this->m_root, key);
+        this->m_numNodes--;
+
+        if (this->m_root != nullptr)
+        {
+            this->m_root = this->Mutable(this->m_root);
+            this->m_root->SetColor(BLACK);
+        }
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    typename PersistentRedBlackTree<typeT, lessComparator, equalComparator>::NodeType*
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::Remove(
+        NodeType*    node,
+        const typeT& key)
+    {
+        node = this->Mutable(node);
+
+        if (this->m_lessComp(key, node->GetValue()))
+        {
+            if (not this->IsRed(node->GetLeftNode()) and
+                not this->IsRed(node->GetLeftNode()->GetLeftNode()))
+                node = this->MoveRed2Left(node);
+
+            node->SetLeftNode(this->Remove(node->GetLeftNode(), key));
+        }
+        else
+        {
+            if (this->IsRed(node->GetLeftNode()))
+                node = this->RotateRight(node);
+
+            if (this->m_equalComp(key, node->GetValue()) and
+                node->GetRightNode() == nullptr)
+            {
+                Release(node);
+                return nullptr;
+            }
+
+            if (not this->IsRed(node->GetRightNode()) and
+                not this->IsRed(node->GetRightNode()->GetLeftNode()))
+                node = this->MoveRed2Right(node);
+
+            if (this->m_equalComp(key, node->GetValue()))
+            {
+                NodeType* successor = node->GetRightNode();
+
+                while (successor->GetLeftNode() != nullptr)
+                    successor = successor->GetLeftNode();
+
+                node->SetValue(successor->GetValue());
+                node->SetRightNode(this->RemoveMin(node->GetRightNode()));
+            }
+            else
+            {
+                node->SetRightNode(this->Remove(node->GetRightNode(), key));
+            }
+        }
+
+        return this->FixUp(node);
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    typename PersistentRedBlackTree<typeT, lessComparator, equalComparator>::NodeType*
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::RemoveMin(
+        NodeType* node)
+    {
+        node = this->Mutable(node);
+
+        if (node->GetLeftNode() == nullptr)
+        {
+            Release(node);
+            return nullptr;
+        }
+
+        if (not this->IsRed(node->GetLeftNode()) and
+            not this->IsRed(node->GetLeftNode()->GetLeftNode()))
+            node = this->MoveRed2Left(node);
+
+        node->SetLeftNode(this->RemoveMin(node->GetLeftNode()));
+
+        return this->FixUp(node);
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    typename PersistentRedBlackTree<typeT, lessComparator, equalComparator>::NodeType*
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::RotateLeft(
+        NodeType* node)
+    {
+        NodeType* pivot = this->Mutable(node->GetRightNode());
+
+        node->SetRightNode(pivot->GetLeftNode());
+        pivot->SetLeftNode(node);
+        pivot->SetColor(node->GetColor());
+        node->SetColor(RED);
+
+        return pivot;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    typename PersistentRedBlackTree<typeT, lessComparator, equalComparator>::NodeType*
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::RotateRight(
+        NodeType* node)
+    {
+        NodeType* pivot = this->Mutable(node->GetLeftNode());
+
+        node->SetLeftNode(pivot->GetRightNode());
+        pivot->SetRightNode(node);
+        pivot->SetColor(node->GetColor());
+        node->SetColor(RED);
+
+        return pivot;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    void PersistentRedBlackTree<typeT, lessComparator, equalComparator>::ChangeFamilyColor(
+        NodeType* node)
+    {
+        node->SetColor(node->GetColor() == BLACK ? RED : BLACK);
+
+        if (node->GetLeftNode() != nullptr)
+        {
+            node->SetLeftNode(this->Mutable(node->GetLeftNode()));
+            node->GetLeftNode()->SetColor(
+                node->GetLeftNode()->GetColor() == BLACK ? RED : BLACK);
+        }
+
+        if (node->GetRightNode() != nullptr)
+        {
+            node->SetRightNode(this->Mutable(node->GetRightNode()));
+            node->GetRightNode()->SetColor(
+                node->GetRightNode()->GetColor() == BLACK ? RED : BLACK);
+        }
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    typename PersistentRedBlackTree<typeT, lessComparator, equalComparator>::NodeType*
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::MoveRed2Left(
+        NodeType* node)
+    {
+        this->ChangeFamilyColor(node);
+
+        if (node->GetRightNode() != nullptr and
+            this->IsRed(node->GetRightNode()->GetLeftNode()))
+        {
+            node->SetRightNode(this->RotateRight(node->GetRightNode()));
+            node = this->RotateLeft(node);
+            this->ChangeFamilyColor(node);
+        }
+
+        return node;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    typename PersistentRedBlackTree<typeT, lessComparator, equalComparator>::NodeType*
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::MoveRed2Right(
+        NodeType* node)
+    {
+        this->ChangeFamilyColor(node);
+
+        if (node->GetLeftNode() != nullptr and
+            this->IsRed(node->GetLeftNode()->GetLeftNode()))
+        {
+            node = this->RotateRight(node);
+            this->ChangeFamilyColor(node);
+        }
+
+        return node;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    typename PersistentRedBlackTree<typeT, lessComparator, equalComparator>::NodeType*
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::FixUp(NodeType* node)
+    {
+        if (this->IsRed(node->GetRightNode()) and not this->IsRed(node->GetLeftNode()))
+            node = this->RotateLeft(node);
+
+        if (this->IsRed(node->GetLeftNode()) and
+            this->IsRed(node->GetLeftNode()->GetLeftNode()))
+            node = this->RotateRight(node);
+
+        if (this->IsRed(node->GetLeftNode()) and this->IsRed(node->GetRightNode()))
+            this->ChangeFamilyColor(node);
+
+        return node;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    typename PersistentRedBlackTree<typeT, lessComparator, equalComparator>::NodeType*
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::Search(
+        NodeType*    node,
+        const typeT& key) const
+    {
+        while (node != nullptr and not this->m_equalComp(key, node->GetValue()))
+        {
+            if (this->m_lessComp(key, node->GetValue()))
+                node = node->GetLeftNode();
+
+            else
+                node = node->GetRightNode();
+        }
+
+        return node;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    const typeT* PersistentRedBlackTree<typeT, lessComparator, equalComparator>::Search(
+        const typeT& key) const
+    {
+        NodeType* node = this->Search(this->m_root, key);
+
+        return node == nullptr ? nullptr : &node->GetValue();
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    bool PersistentRedBlackTree<typeT, lessComparator, equalComparator>::Contains(
+        const typeT& key) const
+    {
+        return this->Search(this->m_root, key) != nullptr;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    typename PersistentRedBlackTree<typeT, lessComparator, equalComparator>::View
+    PersistentRedBlackTree<typeT, lessComparator, equalComparator>::Snapshot() const
+    {
+        return View(this->m_root,
+                        this->m_numNodes,
+                        this->m_lessComp,
+                        this->m_equalComp);
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    std::size_t PersistentRedBlackTree<typeT, lessComparator, equalComparator>::Size() const
+    {
+        return this->m_numNodes;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    bool PersistentRedBlackTree<typeT, lessComparator, equalComparator>::IsEmpty() const
+    {
+        return this->m_numNodes == 0;
+    }
+
+    template<typename typeT, typename lessComparator, typename equalComparator>
+    void PersistentRedBlackTree<typeT, lessComparator, equalComparator>::Clear()
+    {
+        Release(this->m_root);
+
+        this->m_root     = nullptr;
+        this->m_numNodes = 0;
+    }
+} // namespace rbtree
+
+#endif // PERSISTENT_RED_BLACK_TREE_H_
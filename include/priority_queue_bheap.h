@@ -28,6 +28,7 @@ namespace bheap
      *   - Enqueue: O(1 + log n) where log n is the execution time of HeapifyDown
      *   - Dequeue: O(1 + log n) where log n is the execution time of HeapifyUp
      *   - Peek: O(1)
+     *   - Build from a range: O(n)
      *
      * @tparam typeT The type of elements stored in the priority queue
      * @tparam Compare The custom comparator used to determine the priority of elements
@@ -49,6 +50,18 @@ namespace bheap
              */
             PriorityQueue(const Compare& comp = Compare());
 
+            /**
+             * @brief Constructor for PriorityQueue that builds the queue from a range
+             * of elements in O(n), instead of one Enqueue per element
+             * @param first, last The range of elements
+             * @param comp The custom comparator to use (default is the standard
+             * comparator)
+             */
+            template<typename iterator>
+            PriorityQueue(iterator       first,
+                          iterator       last,
+                          const Compare& comp = Compare());
+
             ~PriorityQueue();
 
             /**
@@ -96,6 +109,14 @@ namespace bheap
         : BinaryHeap<typeT, Compare>(comp)
     { }
 
+    template<typename typeT, typename Compare>
+    template<typename iterator>
+    PriorityQueue<typeT, Compare>::PriorityQueue(iterator       first,
+                                                 iterator       last,
+                                                 const Compare& comp)
+        : BinaryHeap<typeT, Compare>(first, last, comp)
+    { }
+
     template<typename typeT, typename Compare>
     PriorityQueue<typeT, Compare>::~PriorityQueue()
     { }
@@ -0,0 +1,381 @@
+/*
+ * Filename: priority_queue_skiplist.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef PRIORITY_QUEUE_SKIPLIST_H_
+#define PRIORITY_QUEUE_SKIPLIST_H_
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+
+#include "comparators.h"
+#include "queue_base.h"
+
+// Skip list namespace
+namespace skiplist
+{
+    /**
+     * @brief Implementation of a priority queue based on a skip list
+     *
+     * The elements are kept sorted in a linked list, like in slkd::PriorityQueue,
+     * but each node also takes part in a random number of express lanes above it.
+     * A node reaches lane i with probability 4^-i, so Enqueue finds the insertion
+     * point by walking the top lane and dropping a lane whenever the next node
+     * would pass it, which visits O(log n) nodes in expectation instead of O(n).
+     * The best element is always the first node, so Peek and Dequeue never search
+     *
+     * Elements with the same priority leave in the order they were inserted, and
+     * iteration visits the elements in the order Dequeue would return them. By
+     * default, it functions as a minimum priority queue. To use it as a maximum
+     * priority queue, provide a custom comparator to the Compare template parameter
+     *
+     * Time complexities:
+     *   - Enqueue: O(log n) expected
+     *   - Dequeue: O(1) expected
+     *   - Peek: O(1)
+     *
+     * @tparam typeT The type of elements stored in the priority queue
+     * @tparam Compare The custom comparator used to determine the priority of elements
+     *
+     * NOTE: By default, the 'Compare' parameter is set to 'comparators::Less<typeT>'
+     * for a minimum priority queue
+     */
+    template<typename typeT, typename Compare = decltype(comparators::Less<typeT>)>
+    class PriorityQueue : public QueueBase<typeT>
+    {
+        private:
+            // Enough lanes for 4^16 elements
+            static constexpr std::size_t MAX_LEVEL = 16;
+
+            // The forward pointers of a node follow it in the same allocation, one
+            // per lane the node takes part in
+            struct Node
+            {
+                typeT       value;
+                std::size_t height;
+
+                Node(const typeT& value, std::size_t height)
+                    : value(value),
+                      height(height)
+                { }
+
+                Node** Next()
+                {
+                    return reinterpret_cast<Node**>(this + 1);
+                }
+            };
+
+            std::array<Node*, MAX_LEVEL> m_head;   // First node of each lane
+            std::size_t                  m_level;  // Number of lanes in use
+            std::size_t                  m_size;
+            std::uint64_t                m_random; // xorshift64 state
+            Compare                      m_comp;   // Custom comparator
+
+            /**
+             * @brief Draw the number of lanes of a new node
+             */
+            std::size_t RandomHeight();
+
+            /**
+             * @brief Allocate a node with its forward pointers
+             */
+            Node* CreateNode(const typeT& element, std::size_t height);
+
+            /**
+             * @brief Destroy a node and free its memory
+             */
+            void DestroyNode(Node* node);
+
+            /**
+             * @brief Removes the first element from the queue
+             */
+            void RemoveHead();
+
+        public:
+            /**
+             * @brief Constructor for PriorityQueue
+             * @param comp The custom comparator to use (default is the standard
+             * comparator)
+             */
+            PriorityQueue(const Compare& comp = Compare());
+
+            PriorityQueue(const PriorityQueue&)            = delete;
+            PriorityQueue& operator=(const PriorityQueue&) = delete;
+
+            ~PriorityQueue();
+
+            /**
+             * @brief Insert a new element into the queue, after every element with
+             * the same priority
+             * @param element New element
+             **/
+            void Enqueue(typeT element) override;
+
+            /**
+             * @brief Get the element with the priority value considered the lowest or
+             * highest without removing it
+             * @return The element with the lowest or highest priority value
+             * @throw std::overflow_error If priority queue is empty
+             **/
+            typeT Peek() override;
+
+            /**
+             * @brief Remove and return the element with the priority value considered
+             * the lowest or highest
+             * @return The element with the lowest or highest priority value
+             * @throw std::underflow_error If priority queue is empty
+             **/
+            typeT Dequeue() override;
+
+            /**
+             * @brief Check if the queue is empty
+             * @return True if it is empty, False otherwise
+             **/
+            bool IsEmpty() override;
+
+            /**
+             * @brief Get the current size of the queue
+             * @return The current size of the queue
+             **/
+            std::size_t Size() override;
+
+            /**
+             * @brief Delete all nodes in the queue
+             **/
+            void Clear() override;
+
+            using pointer   = const typeT*;
+            using reference = const typeT&;
+
+            // Visits the elements in priority order. Elements are read-only, since
+            // changing one could break the order
+            typedef struct Iterator
+            {
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type        = typeT;
+                    using difference_type   = std::ptrdiff_t;
+                    using pointer           = PriorityQueue::pointer;
+                    using reference         = PriorityQueue::reference;
+
+                    Iterator(Node* node)
+                        : m_node(node)
+                    { }
+
+                    Iterator() { }
+
+                    reference operator*() const
+                    {
+                        return m_node->value;
+                    }
+
+                    pointer operator->()
+                    {
+                        return &m_node->value;
+                    }
+
+                    Iterator& operator++()
+                    {
+                        m_node = m_node->Next()[0];
+                        return *this;
+                    }
+
+                    Iterator operator++(int)
+                    {
+                        Iterator tmp = *this;
+                        ++(*this);
+                        return tmp;
+                    }
+
+                    friend bool operator==(const Iterator& a, const Iterator& b)
+                    {
+                        return a.m_node == b.m_node;
+                    };
+
+                    friend bool operator!=(const Iterator& a, const Iterator& b)
+                    {
+                        return a.m_node != b.m_node;
+                    };
+
+                private:
+                    Node* m_node;
+
+            } Iterator;
+
+            Iterator begin()
+            {
+                return Iterator(this->m_head[0]);
+            }
+
+            Iterator end()
+            {
+                return Iterator(nullptr);
+            }
+    };
+
+    template<typename typeT, typename Compare>
+    PriorityQueue<typeT, Compare>::PriorityQueue(const Compare& comp)
+        : m_level(1),
+          m_size(0),
+          m_random(0x9E3779B97F4A7C15ULL),
+          m_comp(comp)
+    {
+        this->m_head.fill(nullptr);
+    }
+
+    template<typename typeT, typename Compare>
+    PriorityQueue<typeT, Compare>::~PriorityQueue()
+    {
+        this->Clear();
+    }
+
+    template<typename typeT, typename Compare>
+    void PriorityQueue<typeT, Compare>::Enqueue(typeT element)
+    {
+        std::size_t height = this->RandomHeight();
+
+        if (height > this->m_level)
+            this->m_level = height;
+
+        // update[i] holds the lane i link that the new node goes after. Walking
+        // past equal elements keeps them in insertion order
+        std::array<Node**, MAX_LEVEL> update;
+        Node**                        forward = this->m_head.data();
+
+        for (std::size_t i = this->m_level; i-- > 0;)
+        {
+            while (forward[i] != nullptr and
+                   not this->m_comp(element, forward[i]->value))
+                forward = forward[i]->Next();
+
+            update[i] = forward;
+        }
+
+        Node* newNode = this->CreateNode(element, height);
+
+        for (std::size_t i = 0; i < height; i++)
+        {
+            newNode->Next()[i] = update[i][i];
+            update[i][i]       = newNode;
+        }
+
+        this->m_size++;
+    }
+
+    template<typename typeT, typename Compare>
+    typeT PriorityQueue<typeT, Compare>::Peek()
+    {
+        if (this->m_size == 0)
+            throw std::overflow_error("Priority Queue is empty!");
+
+        return this->m_head[0]->value;
+    }
+
+    template<typename typeT, typename Compare>
+    typeT PriorityQueue<typeT, Compare>::Dequeue()
+    {
+        if (this->m_size == 0)
+            throw std::underflow_error("Priority Queue is empty!");
+
+        typeT aux = this->m_head[0]->value;
+        this->RemoveHead();
+        return aux;
+    }
+
+    template<typename typeT, typename Compare>
+    bool PriorityQueue<typeT, Compare>::IsEmpty()
+    {
+        return (this->m_size == 0);
+    }
+
+    template<typename typeT, typename Compare>
+    std::size_t PriorityQueue<typeT, Compare>::Size()
+    {
+        return this->m_size;
+    }
+
+    template<typename typeT, typename Compare>
+    void PriorityQueue<typeT, Compare>::Clear()
+    {
+        Node* current = this->m_head[0];
+
+        while (current != nullptr)
+        {
+            Node* next = current->Next()[0];
+            this->DestroyNode(current);
+            current = next;
+        }
+
+        this->m_head.fill(nullptr);
+        this->m_level = 1;
+        this->m_size  = 0;
+    }
+
+    template<typename typeT, typename Compare>
+    std::size_t PriorityQueue<typeT, Compare>::RandomHeight()
+    {
+        this->m_random ^= this->m_random << 13;
+        this->m_random ^= this->m_random >> 7;
+        this->m_random ^= this->m_random << 17;
+
+        // Each pair of trailing zero bits is one more lane, with probability 1/4
+        std::size_t height = 1 + std::countr_zero(this->m_random | (1ULL << 62)) / 2;
+
+        return height < MAX_LEVEL ? height : MAX_LEVEL;
+    }
+
+    template<typename typeT, typename Compare>
+    typename PriorityQueue<typeT, Compare>::Node*
+    PriorityQueue<typeT, Compare>::CreateNode(const typeT& element, std::size_t height)
+    {
+        void* memory = ::operator new(sizeof(Node) + height * sizeof(Node*));
+        Node* node;
+
+        try
+        {
+            node = new (memory) Node(element, height);
+        }
+        catch (...)
+        {
+            ::operator delete(memory);
+            throw;
+        }
+
+        for (std::size_t i = 0; i < height; i++)
+            node->Next()[i] = nullptr;
+
+        return node;
+    }
+
+    template<typename typeT, typename Compare>
+    void PriorityQueue<typeT, Compare>::DestroyNode(Node* node)
+    {
+        node->~Node();
+        ::operator delete(node);
+    }
+
+    template<typename typeT, typename Compare>
+    void PriorityQueue<typeT, Compare>::RemoveHead()
+    {
+        Node* head = this->m_head[0];
+
+        // The first node is first in every lane it takes part in
+        for (std::size_t i = 0; i < head->height; i++)
+            this->m_head[i] = head->Next()[i];
+
+        while (this->m_level > 1 and this->m_head[this->m_level - 1] == nullptr)
+            this->m_level--;
+
+        this->m_size--;
+        this->DestroyNode(head);
+    }
+} // namespace skiplist
+
+#endif // PRIORITY_QUEUE_SKIPLIST_H_
@@ -23,6 +23,8 @@ template<typename typeT>
 class QueueBase
 {
     public:
+        virtual ~QueueBase() = default;
+
         virtual void Enqueue(typeT key) = 0;
 
         virtual typeT Peek() = 0;
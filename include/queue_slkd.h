@@ -8,10 +8,13 @@
 #define QUEUE_SLKD_H_
 
 #include <cstddef>
+#include <limits>
 #include <stdexcept>
+#include <utility>
 
 #include "node.h"
 #include "queue_base.h"
+#include "reclaimer.h"
 
 // Singly linked namespace
 namespace slkd
@@ -36,6 +39,7 @@ namespace slkd
             Node<typeT>* m_first;
             Node<typeT>* m_last;
             std::size_t  m_size;
+            Node<typeT>* m_graveyard; // Detached nodes not freed yet by ClearSome
 
             /**
              * @brief Deletes the first node from the queue
@@ -84,13 +88,30 @@ namespace slkd
              * @brief Delete all nodes in the queue
              **/
             void Clear() override;
+
+            /**
+             * @brief Empty the queue in O(1) and free its nodes on the background
+             * reclaimer thread
+             **/
+            void ClearAsync();
+
+            /**
+             * @brief Free the nodes of the queue a few at a time. When no teardown is
+             * pending, the call detaches every element, so the queue is empty right
+             * away. Each call then frees up to 'budget' detached nodes
+             * @param budget Maximum number of nodes freed by this call
+             * @return True if every detached node was freed, False if more calls are
+             * needed
+             **/
+            bool ClearSome(std::size_t budget);
     };
 
     template<typename typeT>
     Queue<typeT>::Queue()
     {
-        this->m_size  = 0;
-        this->m_first = this->m_last = nullptr;
+        this->m_size      = 0;
+        this->m_first     = this->m_last = nullptr;
+        this->m_graveyard = nullptr;
     }
 
     template<typename typeT>
@@ -154,6 +175,44 @@ namespace slkd
         {
             this->DeleteFirst();
         }
+
+        // Nodes left by an unfinished ClearSome
+        this->ClearSome(std::numeric_limits<std::size_t>::max());
+    }
+
+    template<typename typeT>
+    void Queue<typeT>::ClearAsync()
+    {
+        if (this->IsEmpty())
+            return;
+
+        Queue<typeT>* detached = new Queue<typeT>();
+
+        std::swap(this->m_first, detached->m_first);
+        std::swap(this->m_last, detached->m_last);
+        std::swap(this->m_size, detached->m_size);
+
+        utils::Reclaimer::Instance().Post([detached]() { delete detached; });
+    }
+
+    template<typename typeT>
+    bool Queue<typeT>::ClearSome(std::size_t budget)
+    {
+        if (this->m_graveyard == nullptr and not this->IsEmpty())
+        {
+            this->m_graveyard = this->m_first;
+            this->m_first     = this->m_last = nullptr;
+            this->m_size      = 0;
+        }
+
+        for (; budget > 0 and this->m_graveyard != nullptr; budget--)
+        {
+            Node<typeT>* next = this->m_graveyard->GetNextNode();
+            delete this->m_graveyard;
+            this->m_graveyard = next;
+        }
+
+        return this->m_graveyard == nullptr;
     }
 
     template<typename typeT>
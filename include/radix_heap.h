@@ -0,0 +1,231 @@
+/*
+ * Filename: radix_heap.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef RADIX_HEAP_H_
+#define RADIX_HEAP_H_
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "pair.h"
+#include "queue_base.h"
+#include "vector.h"
+
+// Binary heap namespace
+namespace bheap
+{
+    /**
+     * @brief Implementation of a radix heap: a monotone priority queue for unsigned
+     * integer keys
+     *
+     * A monotone queue never receives a key smaller than the last key it handed
+     * out, as happens with the distances of Dijkstra's algorithm or the timestamps
+     * of an event simulation. The heap keeps the last minimum key and puts every
+     * element in the bucket given by the highest bit where its key differs from
+     * that minimum. Bucket 0 holds the keys equal to the minimum and is served
+     * directly. When it runs out, the first non-empty bucket is split: its smallest
+     * key becomes the new minimum and its elements move to lower buckets. An
+     * element can only move down, so it moves at most once per bit of the key
+     *
+     * Time complexities:
+     *   - Enqueue: O(1)
+     *   - Dequeue: O(log C) amortized, where C is the range of the keys
+     *   - Peek: O(log C) amortized
+     *
+     * @tparam keyT An unsigned integer type for the keys
+     * @tparam valueT The type of the value attached to each key
+     */
+    template<typename keyT, typename valueT>
+    class RadixHeap : public QueueBase<Pair<keyT, valueT>>
+    {
+        static_assert(std::is_unsigned_v<keyT>, "Radix heap keys must be unsigned");
+
+        private:
+            static constexpr std::size_t NUM_BUCKETS =
+                std::numeric_limits<keyT>::digits + 1;
+
+            std::array<Vector<Pair<keyT, valueT>>, NUM_BUCKETS> m_buckets;
+            keyT        m_last; // Minimum key when bucket 0 was last refilled
+            std::size_t m_size;
+
+            /**
+             * @brief Get the bucket of a key, relative to the last minimum key
+             */
+            std::size_t Bucket(keyT key) const;
+
+            /**
+             * @brief Split the first non-empty bucket if bucket 0 is empty, so that
+             * bucket 0 holds the elements with the minimum key
+             */
+            void Refill();
+
+        public:
+            RadixHeap();
+
+            ~RadixHeap();
+
+            /**
+             * @brief Insert a new element into the queue
+             * @param element New element, with the key as its first member
+             * @throw std::invalid_argument If the key is smaller than the last key
+             * returned by Peek or Dequeue
+             **/
+            void Enqueue(Pair<keyT, valueT> element) override;
+
+            /**
+             * @brief Insert a new element into the queue
+             * @throw std::invalid_argument If the key is smaller than the last key
+             * returned by Peek or Dequeue
+             **/
+            void Push(keyT key, const valueT& value);
+
+            /**
+             * @brief Get the element with the smallest key without removing it
+             * @return The element with the smallest key
+             * @throw std::overflow_error If queue is empty
+             **/
+            Pair<keyT, valueT> Peek() override;
+
+            /**
+             * @brief Remove and return the element with the smallest key. Elements
+             * with the same key leave in an unspecified order
+             * @return The element with the smallest key
+             * @throw std::underflow_error If queue is empty
+             **/
+            Pair<keyT, valueT> Dequeue() override;
+
+            /**
+             * @brief Check if the queue is empty
+             * @return True if it is empty, False otherwise
+             **/
+            bool IsEmpty() override;
+
+            /**
+             * @brief Get the current size of the queue
+             * @return The current size of the queue
+             **/
+            std::size_t Size() override;
+
+            /**
+             * @brief Delete all elements in the queue. Any key can be inserted again
+             **/
+            void Clear() override;
+    };
+
+    template<typename keyT, typename valueT>
+    RadixHeap<keyT, valueT>::RadixHeap()
+        : m_last(0),
+          m_size(0)
+    { }
+
+    template<typename keyT, typename valueT>
+    RadixHeap<keyT, valueT>::~RadixHeap()
+    { }
+
+    template<typename keyT, typename valueT>
+    void RadixHeap<keyT, valueT>::Enqueue(Pair<keyT, valueT> element)
+    {
+        if (element.GetFirst() < this->m_last)
+            throw std::invalid_argument("Key is smaller than the last minimum key");
+
+        this->m_buckets[this->Bucket(element.GetFirst())].PushBack(element);
+        this->m_size++;
+    }
+
+    template<typename keyT, typename valueT>
+    void RadixHeap<keyT, valueT>::Push(keyT key, const valueT& value)
+    {
+        this->Enqueue(Pair<keyT, valueT>(key, value));
+    }
+
+    template<typename keyT, typename valueT>
+    Pair<keyT, valueT> RadixHeap<keyT, valueT>::Peek()
+    {
+        if (this->m_size == 0)
+            throw std::overflow_error("Queue is empty!");
+
+        this->Refill();
+        return this->m_buckets[0].Back();
+    }
+
+    template<typename keyT, typename valueT>
+    Pair<keyT, valueT> RadixHeap<keyT, valueT>::Dequeue()
+    {
+        if (this->m_size == 0)
+            throw std::underflow_error("Queue is empty!");
+
+        this->Refill();
+
+        Pair<keyT, valueT> toPop = this->m_buckets[0].Back();
+        this->m_buckets[0].PopBack();
+        this->m_size--;
+
+        return toPop;
+    }
+
+    template<typename keyT, typename valueT>
+    bool RadixHeap<keyT, valueT>::IsEmpty()
+    {
+        return this->m_size == 0;
+    }
+
+    template<typename keyT, typename valueT>
+    std::size_t RadixHeap<keyT, valueT>::Size()
+    {
+        return this->m_size;
+    }
+
+    template<typename keyT, typename valueT>
+    void RadixHeap<keyT, valueT>::Clear()
+    {
+        for (Vector<Pair<keyT, valueT>>& bucket : this->m_buckets)
+            bucket.Clear();
+
+        this->m_last = 0;
+        this->m_size = 0;
+    }
+
+    template<typename keyT, typename valueT>
+    std::size_t RadixHeap<keyT, valueT>::Bucket(keyT key) const
+    {
+        return std::bit_width(static_cast<keyT>(key ^ this->m_last));
+    }
+
+    template<typename keyT, typename valueT>
+    void RadixHeap<keyT, valueT>::Refill()
+    {
+        if (not this->m_buckets[0].IsEmpty())
+            return;
+
+        std::size_t index = 1;
+
+        while (this->m_buckets[index].IsEmpty())
+            index++;
+
+        Vector<Pair<keyT, valueT>>& bucket = this->m_buckets[index];
+
+        keyT minimum = bucket[0].GetFirst();
+
+        for (std::size_t i = 1; i < bucket.Size(); i++)
+            if (bucket[i].GetFirst() < minimum)
+                minimum = bucket[i].GetFirst();
+
+        // Every key of the bucket agrees with the new minimum on the bits above
+        // 'index', so each element lands in a lower bucket
+        this->m_last = minimum;
+
+        for (std::size_t i = 0; i < bucket.Size(); i++)
+            this->m_buckets[this->Bucket(bucket[i].GetFirst())].PushBack(bucket[i]);
+
+        bucket.Clear();
+    }
+} // namespace bheap
+
+#endif // RADIX_HEAP_H_
@@ -0,0 +1,74 @@
+/*
+ * Filename: reclaimer.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef RECLAIMER_H_
+#define RECLAIMER_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace utils
+{
+    /**
+     * @brief Background thread that runs deferred work, such as freeing the nodes of
+     * a structure detached by ClearAsync, away from the thread that requested it
+     *
+     * Jobs run one at a time, in the order they were posted
+     */
+    class Reclaimer
+    {
+        private:
+            std::mutex                        m_mutex;
+            std::condition_variable           m_wake; // Signaled when a job is posted
+            std::condition_variable           m_idle; // Signaled when the queue drains
+            std::deque<std::function<void()>> m_jobs;
+            bool                              m_busy; // True while a job is running
+            std::thread                       m_thread;
+
+            Reclaimer();
+
+            /**
+             * @brief Loop of the background thread
+             */
+            void Run();
+
+        public:
+            Reclaimer(const Reclaimer&)            = delete;
+            Reclaimer& operator=(const Reclaimer&) = delete;
+
+            /**
+             * @brief Get the reclaimer shared by every structure
+             *
+             * The reclaimer is intentionally never destroyed, so structures that
+             * outlive static destruction can still post their work. Jobs still queued
+             * when the program exits are dropped, and the system takes their memory
+             * back
+             */
+            static Reclaimer& Instance();
+
+            /**
+             * @brief Queue a job for the background thread
+             * @param job The work to be done. It must not throw
+             */
+            void Post(std::function<void()> job);
+
+            /**
+             * @brief Wait until every job posted so far has run
+             */
+            void Drain();
+
+            /**
+             * @return The number of jobs waiting to run
+             */
+            std::size_t Pending();
+    };
+} // namespace utils
+
+#endif // RECLAIMER_H_
@@ -7,12 +7,35 @@
 #ifndef RED_BLACK_TREE_H_
 #define RED_BLACK_TREE_H_
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "comparators.h"
+#include "frozen_map.h"
 #include "node_rbtree.h"
+#include "pair.h"
+#include "reclaimer.h"
+#include "red_black_tree_stats.h"
+
+// Number of independent lookups interleaved by the batch searches. Each round
+// advances every lookup of the group by one level and prefetches the next node, so
+// up to this many cache misses are in flight at the same time
+#define RBTREE_BATCH_GROUP 16
 
 namespace rbtree
 {
@@ -33,20 +56,207 @@ namespace rbtree
      * @tparam typeT The type of elements stored in the Red-Black Tree
      * @tparam lessComparator The custom comparator for less-than comparisons
      * @tparam equalComparator The custom comparator for equal comparisons
+     * @tparam nodeT The node layout (Node, CompactNode or IndexNode)
+     *
+     * Keys may carry an augmentation: if 'typeT' has a member function
+     * Augment(const typeT* left, const typeT* right), it is called whenever the
+     * children of a node change (insertion, removal, rotation and BuildSorted), so
+     * a key can summarize its subtree. Join, Split and the set operations do not
+     * maintain it
+     *
+     * Compact and CompactStep move the nodes into an arena in key order, so that an
+     * in-order walk reads memory sequentially instead of jumping around the heap
      */
     template<typename typeT,
              typename lessComparator  = decltype(comparators::Less<typeT>),
-             typename equalComparator = decltype(comparators::Equal<typeT>)>
+             typename equalComparator = decltype(comparators::Equal<typeT>),
+             template<typename> class nodeT = Node>
     class RedBlackTree
     {
         protected:
-            Node<typeT>* m_root;     // Pointer to the root node
-            std::size_t  m_numNodes; // Total number of nodes in the tree
+            nodeT<typeT>*       m_root;      // Pointer to the root node
+            nodeT<typeT>*       m_rightmost; // Greatest node, or nullptr if not cached
+            std::size_t         m_numNodes;  // Total number of nodes in the tree
+            bool                m_multi;     // True once InsertMulti stored a key
 
             // Custom comparators
             lessComparator  m_lessComp;
             equalComparator m_equalComp;
 
+#ifdef RBTREE_TELEMETRY
+            TelemetryCounters m_telemetry;
+#endif
+
+            // Sampled validation: one random path is checked every
+            // m_validationInterval mutations (0 disables it)
+            std::size_t   m_validationInterval;
+            std::size_t   m_mutations;
+            std::uint64_t m_sampleState;
+
+            /**
+             * @brief Count a mutation and run ValidateSample when the validation
+             * interval is reached
+             */
+            void CountMutation();
+
+            /**
+             * @brief Block of nodes filled by Compact in key order. Split and the set
+             * operations move nodes between trees, so every tree holding nodes of an
+             * arena shares it, and the storage is released with the last reference
+             */
+            struct NodeArena
+            {
+                nodeT<typeT>*            nodes;    // Storage for 'capacity' nodes
+                std::size_t              capacity; // Number of slots
+                std::size_t              used;     // Slots filled so far
+                std::atomic<std::size_t> live;     // Nodes not freed yet
+
+                NodeArena(std::size_t capacity);
+                ~NodeArena();
+
+                /**
+                 * @return True if 'node' is stored in this arena, False otherwise
+                 */
+                bool Contains(const nodeT<typeT>* node) const;
+            };
+
+            // Arenas holding nodes of this tree, sorted by the address of their
+            // storage so the arena of a node is found by binary search
+            std::vector<std::shared_ptr<NodeArena>> m_arenas;
+
+            // Next node to be moved by a running compaction, or nullptr if there is
+            // none
+            nodeT<typeT>* m_compactCursor;
+
+            // Arena being filled by the running compaction
+            NodeArena* m_compactArena;
+
+            // Detached subtrees whose nodes ClearSome has not freed yet
+            std::vector<nodeT<typeT>*> m_graveyard;
+
+            // Nodes with their own allocator (IndexNode) cannot leave it
+            static constexpr bool IS_RELOCATABLE =
+                not requires { nodeT<typeT>::operator new(std::size_t(1)); };
+
+            /**
+             * @brief Move a node to the next slot of an arena, rewiring its parent and
+             * children, and free the old node
+             * @param node The node to be moved
+             * @param arena The arena that receives it. Must have a free slot
+             * @return The node at its new address
+             */
+            nodeT<typeT>* Relocate(nodeT<typeT>* node, NodeArena& arena);
+
+            /**
+             * @brief Stop a running compaction. The nodes moved so far stay in the
+             * arena
+             */
+            void StopCompaction();
+
+            /**
+             * @brief Take the arenas of another tree whose nodes are moving into this
+             * one
+             * @param other The tree giving its nodes
+             */
+            void AdoptArenas(RedBlackTree& other);
+
+            /**
+             * @brief Add an arena to m_arenas, keeping it sorted. An arena that is
+             * already there is not added again
+             * @param arena The arena to be added
+             */
+            void AddArena(const std::shared_ptr<NodeArena>& arena);
+
+            /**
+             * @brief Find the arena that stores a node in O(log a), where a is the
+             * number of arenas
+             * @param node A node of this tree
+             * @return The arena of the node, or nullptr if it was allocated on its own
+             */
+            NodeArena* FindArena(const nodeT<typeT>* node) const;
+
+            /**
+             * @brief Drop the arenas whose nodes were all freed
+             */
+            void ReleaseArenas();
+
+            /**
+             * @brief Copy a subtree with its shape and colors (recursive call). The
+             * left subtree is copied first, so the copies are created in key order
+             * @param node The root of the subtree to be copied
+             * @param parent The parent of the copy
+             * @param arena The arena that receives the copies, or nullptr to allocate
+             * them one by one
+             * @return The root of the copy
+             */
+            nodeT<typeT>*
+            Clone(nodeT<typeT>* node, nodeT<typeT>* parent, NodeArena* arena);
+
+            // True if the keys summarize their subtrees through Augment
+            static constexpr bool IS_AUGMENTED =
+                requires(typeT& key, const typeT* child) { key.Augment(child, child); };
+
+            /**
+             * @brief Recompute the augmentation of a node from its children. Does
+             * nothing if the keys are not augmented
+             * @param node The node to be updated
+             */
+            void Augment(nodeT<typeT>* node);
+
+            /**
+             * @brief Recompute the augmentation of a node and of all its ancestors
+             * @param node The lowest node whose subtree changed (may be null)
+             */
+            void AugmentPath(nodeT<typeT>* node);
+
+            /**
+             * @brief Build a perfectly balanced subtree from a sorted range (recursive
+             * call). Nodes at 'redDepth' are red and the others black, so every path
+             * has the same black height
+             * @param keys The sorted keys
+             * @param parent The parent of the subtree
+             * @param depth The depth of the subtree root
+             * @param redDepth The depth of the deepest level
+             * @return The root of the subtree
+             */
+            nodeT<typeT>* BuildSorted(std::span<const typeT> keys,
+                                      nodeT<typeT>*          parent,
+                                      std::size_t            depth,
+                                      std::size_t            redDepth);
+
+            /**
+             * @brief Compare two keys with the less-than comparator
+             * @return True if 'a' is smaller than 'b', False otherwise
+             */
+            bool Less(const typeT& a, const typeT& b);
+
+            /**
+             * @brief Compare two keys with the equal comparator
+             * @return True if 'a' is equal to 'b', False otherwise
+             */
+            bool Equal(const typeT& a, const typeT& b);
+
+            /**
+             * @brief Allocate a node. Every node of the tree is created here
+             * @param key The key to be stored
+             * @param parent The parent of the new node
+             * @return Pointer to the new node
+             */
+            nodeT<typeT>* NewNode(const typeT& key, nodeT<typeT>* parent = nullptr);
+
+            /**
+             * @brief Delete a node. Every node of the tree is deleted here
+             * @param node The node to be deleted
+             */
+            void FreeNode(nodeT<typeT>* node);
+
+            /**
+             * @brief Set the color of a node while rebalancing the tree
+             * @param node The node to be painted
+             * @param color The new color
+             */
+            void Recolor(nodeT<typeT>* node, Color color);
+
             /**
              * @brief Insert a new key-value pair into the Red-Black Tree.
              * @param parent The parent node of the current recursive call.
@@ -54,33 +264,67 @@ namespace rbtree
              * @param key The key to be stored.
              * @return Pointer to the new node that was inserted.
              */
-            Node<typeT>*
-            Insert(Node<typeT>* parent, Node<typeT>*& node, const typeT& key);
+            nodeT<typeT>*
+            Insert(nodeT<typeT>* parent, nodeT<typeT>* node, const typeT& key);
+
+            /**
+             * @brief Create a node for a key and link it as a child of a node whose
+             * corresponding link is null, then rebalance the tree
+             * @param parent The parent of the new node, or nullptr for an empty tree
+             * @param isLeft True to link the new node as the left child, False for the
+             * right child
+             * @param key The key to be stored
+             * @return Pointer to the new node
+             */
+            nodeT<typeT>* Link(nodeT<typeT>* parent, bool isLeft, const typeT& key);
+
+            /**
+             * @brief Get the node with the greatest key, walking the right spine only
+             * if it is not cached
+             * @return Pointer to the rightmost node, or nullptr if the tree is empty
+             */
+            nodeT<typeT>* GetRightmost();
 
             /**
              * @brief Corrects the Red-Black Tree properties after an insertion.
              * @param node The node that was inserted.
              */
-            void FixInsert(Node<typeT>* node);
+            void FixInsert(nodeT<typeT>* node);
+
+            /**
+             * @brief Overload that works on the subtree rooted at 'root' instead of
+             * the whole tree
+             * @param node The node that was inserted
+             * @param root The root of the subtree, updated if a rotation replaces it
+             * @return True if the root had to be recolored black, that is, if the
+             * black height of the subtree grew
+             */
+            bool FixInsert(nodeT<typeT>* node, nodeT<typeT>*& root);
 
             /**
              * @brief Delete a specific node
              * @param node The node to be deleted
              */
-            void DeleteNode(Node<typeT>* node);
+            void DeleteNode(nodeT<typeT>* node);
 
             /**
              * @brief Corrects the Red-Black Tree properties after a deletion
-             * @param node The node from which the correction will start
+             * @param node The node from which the correction will start (may be null)
+             * @param parent The parent of that node
              */
-            void FixDelete(Node<typeT>* node);
+            void FixDelete(nodeT<typeT>* node, nodeT<typeT>* parent);
+
+            /**
+             * @return True if the node is black, False otherwise (null nodes are black)
+             */
+            bool IsBlack(nodeT<typeT>* node);
 
             /**
              * @brief Transplants one node with another
              * @param node1 The first node
              * @param node2 The second node
              */
-            void Transplant(Node<typeT>*& node1, Node<typeT>*& node2);
+            void Transplant(nodeT<typeT>* node1, nodeT<typeT>* node2);
 
             /**
              * @brief Search for the node containing a specific key
@@ -88,60 +332,246 @@ namespace rbtree
              * @param key The key used in the search
              * @return Pointer to the node or nullptr if the node was not found
              */
-            Node<typeT>* Search(Node<typeT>* node, const typeT& key);
+            nodeT<typeT>* Search(nodeT<typeT>* node, const typeT& key);
 
             /**
              * @brief Perform a left rotation
              * @param node The node to be rotated
              * @return Pointer to the node that takes the place of the rotated node
              */
-            Node<typeT>* RotateLeft(Node<typeT>* node);
+            nodeT<typeT>* RotateLeft(nodeT<typeT>* node);
 
             /**
              * @brief Perform a right rotation
              * @param node The node to be rotated
              * @return Pointer to the node that takes the place of the rotated node
              */
-            Node<typeT>* RotateRight(Node<typeT>* node);
+            nodeT<typeT>* RotateRight(nodeT<typeT>* node);
+
+            /**
+             * @brief Perform a left rotation inside the subtree rooted at 'root'
+             * @param node The node to be rotated
+             * @param root The root of the subtree, updated if the rotation replaces it
+             * @return Pointer to the node that takes the place of the rotated node
+             */
+            nodeT<typeT>* RotateLeft(nodeT<typeT>* node, nodeT<typeT>*& root);
+
+            /**
+             * @brief Perform a right rotation inside the subtree rooted at 'root'
+             * @param node The node to be rotated
+             * @param root The root of the subtree, updated if the rotation replaces it
+             * @return Pointer to the node that takes the place of the rotated node
+             */
+            nodeT<typeT>* RotateRight(nodeT<typeT>* node, nodeT<typeT>*& root);
 
             /**
              * @brief Move a red node to the left
              * @param node The node to be moved
              * @return Pointer to the node that takes the place of the moved node
              */
-            Node<typeT>* MoveRed2Left(Node<typeT>* node);
+            nodeT<typeT>* MoveRed2Left(nodeT<typeT>* node);
 
             /**
              * @brief Move a red node to the right
              * @param node The node to be moved
              * @return Pointer to the node that takes the place of the moved node
              */
-            Node<typeT>* MoveRed2Right(Node<typeT>* node);
+            nodeT<typeT>* MoveRed2Right(nodeT<typeT>* node);
 
             /**
              * @brief Find the leftmost node (smallest key)
              * @param node The node where the search will begin
              * @return Pointer to the leftmost node
              */
-            Node<typeT>* FindSuccessor(Node<typeT>* node);
+            nodeT<typeT>* FindSuccessor(nodeT<typeT>* node);
+
+            /**
+             * @brief Find the in-order predecessor of a node
+             * @param node The node whose predecessor is wanted
+             * @return Pointer to the predecessor, or nullptr if 'node' is the leftmost
+             */
+            nodeT<typeT>* FindPredecessor(nodeT<typeT>* node);
+
+            /**
+             * @brief Find the first node whose key is not smaller than 'key'
+             * @return Pointer to the node, or nullptr if every key is smaller
+             */
+            nodeT<typeT>* LowerBound(const typeT& key);
+
+            /**
+             * @brief Find the first node whose key is greater than 'key'
+             * @return Pointer to the node, or nullptr if no key is greater
+             */
+            nodeT<typeT>* UpperBound(const typeT& key);
 
             /**
              * @brief Delete the leftmost node
              * @param node The node where the search for the leftmost node will begin
-             * @return
+             * @return The root of the subtree after the removal
              */
-            Node<typeT>* DeleteLeftMostNode(Node<typeT>* node);
+            nodeT<typeT>* DeleteLeftMostNode(nodeT<typeT>* node);
 
             /**
              * @brief Modify the color of a family of nodes (node and its children)
              * @param parent The node where the modification will occur
              */
-            void ChangeFamilyColor(Node<typeT>* parent);
+            void ChangeFamilyColor(nodeT<typeT>* parent);
 
             /**
              * @brief Delete the entire Red-Black Tree (recursive call)
              */
-            void Clear(Node<typeT>*& node);
+            void Clear(nodeT<typeT>* node);
+
+            /**
+             * @brief Count the black nodes from a node to the leftmost null leaf
+             * @param node The root of the subtree
+             * @return The black height of the subtree
+             */
+            std::size_t GetBlackHeight(nodeT<typeT>* node);
+
+            /**
+             * @brief Black height of a child once it is detached from its parent
+             * @param child The child, which may be null
+             * @param height The black height of its black parent
+             * @return The black height of the detached child
+             */
+            static std::size_t ChildHeight(nodeT<typeT>* child, std::size_t height);
+
+            /**
+             * @brief Turn a subtree into a standalone Red-Black Tree: its root loses
+             * the parent and becomes black
+             * @param node The root of the subtree
+             * @return The same node
+             */
+            nodeT<typeT>* Detach(nodeT<typeT>* node);
+
+            /**
+             * @brief Join two trees and a middle node, where every key of 'left' is
+             * smaller than the middle key and every key of 'right' is greater. The
+             * middle node is linked at the spine of the taller tree where the black
+             * heights match, and FixInsert repairs it in O(|bh(left) - bh(right)| + 1)
+             *
+             * NOTE: The black heights are passed by the caller, so the recursive
+             * operations never walk a tree to measure them
+             * @param left The root of the left tree
+             * @param leftHeight The black height of 'left'
+             * @param middle A detached node
+             * @param right The root of the right tree
+             * @param rightHeight The black height of 'right'
+             * @param height Receives the black height of the joined tree
+             * @return The root of the joined tree
+             */
+            nodeT<typeT>* Join(nodeT<typeT>* left,
+                               std::size_t   leftHeight,
+                               nodeT<typeT>* middle,
+                               nodeT<typeT>* right,
+                               std::size_t   rightHeight,
+                               std::size_t&  height);
+
+            /**
+             * @brief Join two trees, where every key of 'left' is smaller than every
+             * key of 'right'
+             * @param height Receives the black height of the joined tree
+             * @return The root of the joined tree
+             */
+            nodeT<typeT>* Join(nodeT<typeT>* left,
+                               std::size_t   leftHeight,
+                               nodeT<typeT>* right,
+                               std::size_t   rightHeight,
+                               std::size_t&  height);
+
+            /**
+             * @brief Detach the rightmost node of a tree
+             * @param node The root of the tree
+             * @param height The black height of the tree
+             * @param rest Receives the root of the tree without its rightmost node
+             * @param restHeight Receives the black height of 'rest'
+             * @return The detached node
+             */
+            nodeT<typeT>* SplitLast(nodeT<typeT>*  node,
+                                    std::size_t    height,
+                                    nodeT<typeT>*& rest,
+                                    std::size_t&   restHeight);
+
+            /**
+             * @brief Split a tree by a key (recursive call)
+             * @param node The root of the tree
+             * @param height The black height of the tree
+             * @param key The key used to split the tree
+             * @param left Receives the tree with the keys smaller than 'key'
+             * @param leftHeight Receives the black height of 'left'
+             * @param right Receives the tree with the keys greater than 'key'
+             * @param rightHeight Receives the black height of 'right'
+             * @return The detached node equal to 'key', or nullptr
+             */
+            nodeT<typeT>* Split(nodeT<typeT>*  node,
+                                std::size_t    height,
+                                const typeT&   key,
+                                nodeT<typeT>*& left,
+                                std::size_t&   leftHeight,
+                                nodeT<typeT>*& right,
+                                std::size_t&   rightHeight);
+
+            /**
+             * @brief Union of two trees. When both trees have the same key, the node
+             * from 'tree1' is kept
+             * @param height1 The black height of 'tree1'
+             * @param height2 The black height of 'tree2'
+             * @param duplicates Incremented by the number of discarded nodes
+             * @param forkDepth Number of recursion levels that still run the left
+             * half in another thread
+             * @param height Receives the black height of the new tree
+             * @return The root of the new tree
+             */
+            nodeT<typeT>* Union(nodeT<typeT>* tree1,
+                                std::size_t   height1,
+                                nodeT<typeT>* tree2,
+                                std::size_t   height2,
+                                std::size_t&  duplicates,
+                                std::size_t   forkDepth,
+                                std::size_t&  height);
+
+            /**
+             * @brief Intersection of two trees, keeping the nodes from 'tree1'
+             * @param kept Incremented by the number of nodes in the new tree
+             * @param forkDepth See Union
+             * @return The root of the new tree
+             */
+            nodeT<typeT>* Intersection(nodeT<typeT>* tree1,
+                                       std::size_t   height1,
+                                       nodeT<typeT>* tree2,
+                                       std::size_t   height2,
+                                       std::size_t&  kept,
+                                       std::size_t   forkDepth,
+                                       std::size_t&  height);
+
+            /**
+             * @brief Keys of 'tree1' that are not in 'tree2'
+             * @param removed Incremented by the number of nodes removed from 'tree1'
+             * @param forkDepth See Union
+             * @return The root of the new tree
+             */
+            nodeT<typeT>* Difference(nodeT<typeT>* tree1,
+                                     std::size_t   height1,
+                                     nodeT<typeT>* tree2,
+                                     std::size_t   height2,
+                                     std::size_t&  removed,
+                                     std::size_t   forkDepth,
+                                     std::size_t&  height);
+
+            /**
+             * @brief Convert a number of threads into a fork depth for the set
+             * operations
+             */
+            static std::size_t GetForkDepth(std::size_t numThreads);
+
+            /**
+             * @brief Run 'leftTask' in another thread while this thread runs
+             * 'rightTask', and wait for both. With telemetry, the other thread
+             * counts into its own counters, which are merged after the wait
+             */
+            template<typename leftFunction, typename rightFunction>
+            void Fork(leftFunction leftTask, rightFunction rightTask);
 
             /**
              * @brief Print the tree
@@ -150,44 +580,190 @@ namespace rbtree
              * @param sideIsLeft Should receive True if the node is on the left side or
              * False if the node is on the right side
              */
-            void DumpTree(Node<typeT>*&      node,
+            void DumpTree(nodeT<typeT>*      node,
                           const std::string& prefix,
                           std::ofstream&     output,
                           bool               isLeft,
                           int                depth);
 
             /**
-             * @brief Check the number of black nodes in the tree
-             * @param node The current node in the recursive call
-             * @return The number of black nodes
+             * @brief Check the invariants of a subtree in a single pass (recursive
+             * call)
+             * @param node The root of the subtree
+             * @param depth The depth of 'node'
+             * @param previous The last node visited in order, updated as the subtree
+             * is visited
+             * @param count Incremented by the number of nodes of the subtree
+             * @return The black height of the subtree
+             * @throw std::logic_error If an invariant is violated
              */
-            std::size_t GetBlackNodeCount(Node<typeT>*& node);
+            std::size_t Validate(nodeT<typeT>*  node,
+                                 std::size_t    depth,
+                                 nodeT<typeT>*& previous,
+                                 std::size_t&   count) const;
 
             /**
-             * @brief Check if the Red-Black Tree properties are satisfied
-             * @param node The current node in the recursive call
+             * @brief Add the shape of a subtree to the stats (recursive call)
+             * @param node The root of the subtree
+             * @param depth The depth of 'node'
+             * @param stats The stats being computed
              */
-            bool IsRedBlackTreeBalanced(Node<typeT>*& node);
+            void CollectStats(nodeT<typeT>* node,
+                              std::size_t   depth,
+                              TreeStats&    stats) const;
+
+            /**
+             * @brief Search up to RBTREE_BATCH_GROUP keys at once, descending all of
+             * them one level per round and prefetching the next nodes
+             * @param keys The keys used in the search
+             * @param count Number of keys, at most RBTREE_BATCH_GROUP
+             * @param out Receives the node of each key, or nullptr
+             */
+            void SearchGroup(const typeT* keys, std::size_t count, nodeT<typeT>** out);
 
         public:
             RedBlackTree(const lessComparator&  lessComp  = lessComparator(),
                          const equalComparator& equalComp = equalComparator());
 
+            /**
+             * @brief Copy constructor. Copies the shape of the other tree in O(n)
+             * instead of inserting its keys, with every node in a single allocation
+             * laid out in key order. The telemetry counters start at zero
+             */
+            RedBlackTree(const RedBlackTree& other);
+
+            /**
+             * @brief Move constructor. O(1): takes the nodes of the other tree, which
+             * becomes empty
+             */
+            RedBlackTree(RedBlackTree&& other);
+
             ~RedBlackTree();
 
+            /**
+             * @brief Copy assignment operator. O(n), see the copy constructor
+             */
+            RedBlackTree& operator=(const RedBlackTree& other);
+
+            /**
+             * @brief Move assignment operator. Deletes the elements of this tree and
+             * takes the nodes of the other one, which becomes empty
+             */
+            RedBlackTree& operator=(RedBlackTree&& other);
+
+            /**
+             * @brief Exchange the contents of two trees in O(1). Node pointers stay
+             * valid and follow their elements. The telemetry counters stay with each
+             * tree
+             * @param other The other tree
+             */
+            void Swap(RedBlackTree& other);
+
             /**
              * @brief Overload to insert a new element without the node pointer
              * @param key Key to be stored in the Red-Black Tree
              * @return Pointer to the inserted node
              */
-            Node<typeT>* Insert(const typeT& key);
+            nodeT<typeT>* Insert(const typeT& key);
+
+            /**
+             * @brief Insert a key starting from a node next to its position instead of
+             * the root. Takes amortized O(1) when the key belongs right before or
+             * right after the hint, and falls back to a descent from the root when the
+             * hint is wrong
+             * @param hint A node of this tree near the key, such as the node returned
+             * by the previous insertion. nullptr hints the end of the tree, as Append
+             * @param key Key to be stored in the Red-Black Tree
+             * @return Pointer to the inserted node, or to the node that already had the
+             * key
+             */
+            nodeT<typeT>* Insert(nodeT<typeT>* hint, const typeT& key);
+
+            /**
+             * @brief Insert a key greater than every key of the tree in amortized O(1),
+             * linking it after the cached rightmost node. Keys that are not greater
+             * fall back to the usual insertion
+             * @param key Key to be stored in the Red-Black Tree
+             * @return Pointer to the inserted node, or to the node that already had the
+             * key
+             */
+            nodeT<typeT>* Append(const typeT& key);
+
+            /**
+             * @brief Insert a key even if the tree already has equal keys, turning the
+             * tree into a multiset. Equal keys are kept in insertion order. Join,
+             * Split and the set operations expect unique keys. Each copy takes a
+             * whole node; when only the number of copies matters, MultiSet keeps one
+             * node per distinct key instead
+             * @param key Key to be stored in the Red-Black Tree
+             * @return Pointer to the new node
+             */
+            nodeT<typeT>* InsertMulti(const typeT& key);
+
+            /**
+             * @brief Count the copies of a key in O(log n + k)
+             * @param key The key to be counted
+             * @return The number of nodes equal to 'key'
+             */
+            std::size_t Count(const typeT& key);
+
+            /**
+             * @brief Get the nodes equal to a key
+             * @param key The key used in the search
+             * @return The first node equal to 'key' and the first node after them, so
+             * the copies are [first, second) following Next. Both are equal when the
+             * key is not in the tree, and nullptr stands for the end of the tree
+             */
+            Pair<nodeT<typeT>*, nodeT<typeT>*> EqualRange(const typeT& key);
+
+            /**
+             * @brief Get the node that follows another one in order
+             * @param node A node of this tree
+             * @return Pointer to the next node, or nullptr if 'node' is the last one
+             */
+            nodeT<typeT>* Next(nodeT<typeT>* node);
 
             /**
              * @brief Search for the node containing a specific key
              * @param key The key used in the search
              * @return Pointer to the node or nullptr if the node was not found
              */
-            Node<typeT>* Search(const typeT& key);
+            nodeT<typeT>* Search(const typeT& key);
+
+            /**
+             * @brief Replace the contents of the tree with sorted keys in O(n),
+             * building a balanced tree directly instead of inserting them one by one
+             * @param keys Keys in ascending order. Equal neighbours are kept, as
+             * InsertMulti does
+             * @throw std::invalid_argument If the keys are not sorted
+             */
+            void BuildSorted(std::span<const typeT> keys);
+
+            /**
+             * @brief Insert a batch of keys. The batch is sorted first and each key is
+             * inserted with the previous one as hint, so runs of keys that land
+             * between the same two nodes of the tree skip the descent from the root
+             * @param keys Keys to be stored in the Red-Black Tree
+             */
+            void InsertBatch(std::span<const typeT> keys);
+
+            /**
+             * @brief Search for a batch of keys, interleaving the descents so that
+             * their cache misses overlap
+             * @param keys The keys used in the search
+             * @param out Receives the node of each key, or nullptr if it was not found
+             * @throw std::invalid_argument If 'out' is smaller than 'keys'
+             */
+            void SearchBatch(std::span<const typeT> keys, std::span<nodeT<typeT>*> out);
+
+            /**
+             * @brief Check a batch of keys, interleaving the descents so that their
+             * cache misses overlap
+             * @param keys The keys used in the search
+             * @param out Receives True for each key found, False otherwise
+             * @throw std::invalid_argument If 'out' is smaller than 'keys'
+             */
+            void ContainsBatch(std::span<const typeT> keys, std::span<bool> out);
 
             /**
              * @brief Returns the number of elements in the Red-Black Tree
@@ -207,6 +783,32 @@ namespace rbtree
              */
             bool IsRedBlackTreeBalanced();
 
+            /**
+             * @brief Check every invariant of the tree in a single O(n) pass: the
+             * keys are in order (only copies from InsertMulti may be equal), the
+             * root is black, no red node has a red child, every path has the same
+             * black height, the parent pointers match the child links and the size
+             * is right
+             * @throw std::logic_error Describing the first violation found
+             */
+            void Validate() const;
+
+            /**
+             * @brief Check the invariants along one random root-to-leaf path in
+             * O(log n): the ordering of the keys against their ancestors, the colors,
+             * the black height against the leftmost path and the parent pointers
+             * @throw std::logic_error Describing the first violation found
+             */
+            void ValidateSample();
+
+            /**
+             * @brief Run ValidateSample after every 'interval' insertions and
+             * removals, so validation can stay on in production builds at a bounded
+             * cost
+             * @param interval Number of mutations between checks. 0 disables it
+             */
+            void SetValidationInterval(std::size_t interval);
+
             /**
              * @brief Prints the tree
              * @param output The file where the printing will be done
@@ -214,82 +816,450 @@ namespace rbtree
             void DumpTree(const std::string& filename);
 
             /**
-             * @brief Remove an element from the Red-Black Tree
+             * @brief Remove an element from the Red-Black Tree. If the key has copies,
+             * only one of them is removed
              * @param key Key of the element to be removed
              */
             void Remove(const typeT& key);
 
+            /**
+             * @brief Remove every copy of a key. The first copy is found once and
+             * the others by walking successors, so reaching the k copies costs
+             * O(log n + k) besides the rebalancing of each removal
+             * @param key Key of the elements to be removed
+             * @return The number of removed nodes
+             */
+            std::size_t RemoveAll(const typeT& key);
+
             /**
              * @brief Deletes the entire Red-Black Tree
              */
             void Clear();
+
+            /**
+             * @brief Empty the tree in O(1) and free its nodes on the background
+             * reclaimer thread, so a huge tree can be dropped without a pause
+             */
+            void ClearAsync();
+
+            /**
+             * @brief Free the nodes of the tree a few at a time. When no teardown is
+             * pending, the call detaches every element, so the tree is empty and
+             * usable right away. Each call then frees up to 'budget' detached nodes
+             * @param budget Maximum number of nodes freed by this call
+             * @return True if every detached node was freed, False if more calls are
+             * needed
+             */
+            bool ClearSome(std::size_t budget);
+
+            /**
+             * @brief Move every element of 'other' to the end of this tree in
+             * O(log n). 'other' becomes empty
+             * @param other Tree whose keys are all greater than the keys of this tree
+             * @throw std::invalid_argument If the key ranges overlap
+             */
+            void Join(RedBlackTree& other);
+
+            /**
+             * @brief Split the tree by a key. This tree keeps the keys smaller than
+             * 'key' and 'right' receives the other ones. The split itself takes
+             * O(log n), and counting the smaller side takes O(min(k, n - k)) more
+             * @param key The key used to split the tree
+             * @param right The tree that receives the keys greater than or equal to
+             * 'key'. Its previous elements are deleted
+             */
+            void Split(const typeT& key, RedBlackTree& right);
+
+            /**
+             * @brief Move every element of 'other' into this tree, in
+             * O(m log(n/m + 1)) for trees of sizes m <= n. On equal keys, the element
+             * of this tree is kept. 'other' becomes empty
+             * @param other The other tree
+             * @param numThreads Number of threads used by the recursion
+             */
+            void Union(RedBlackTree& other, std::size_t numThreads = 1);
+
+            /**
+             * @brief Keep only the keys that are also in 'other', in
+             * O(m log(n/m + 1)). 'other' becomes empty
+             * @param other The other tree
+             * @param numThreads Number of threads used by the recursion
+             */
+            void Intersection(RedBlackTree& other, std::size_t numThreads = 1);
+
+            /**
+             * @brief Remove the keys that are in 'other', in O(m log(n/m + 1)).
+             * 'other' becomes empty
+             * @param other The other tree
+             * @param numThreads Number of threads used by the recursion
+             */
+            void Difference(RedBlackTree& other, std::size_t numThreads = 1);
+
+            /**
+             * @brief Copy the keys into an immutable set in Eytzinger layout, which
+             * answers lookups much faster than the tree. The tree is not modified
+             * @return The frozen set
+             */
+            FrozenSet<typeT, lessComparator, equalComparator> Freeze();
+
+            /**
+             * @brief Measure the shape of the tree in O(n): height, black height,
+             * number of nodes at each depth and bytes used. Also carries a snapshot
+             * of the telemetry counters when RBTREE_TELEMETRY is defined
+             * @return The stats of the tree
+             */
+            TreeStats Stats() const;
+
+            /**
+             * @brief Set the telemetry counters to zero. Does nothing when
+             * RBTREE_TELEMETRY is not defined
+             */
+            void ResetTelemetry();
+
+            /**
+             * @brief Move every node into a single arena, laid out in key order, so
+             * that ordered iteration walks memory sequentially. Invalidates the node
+             * pointers and iterators held by the caller
+             */
+            void Compact();
+
+            /**
+             * @brief Run a bounded part of a compaction, so it can be spread over time
+             * without long pauses. A compaction starts on the first call and goes on
+             * across insertions and removals. Nodes inserted behind its progress stay
+             * where they are. Clear, Join, Split, BuildSorted and the set operations
+             * stop it. Invalidates the node pointers and iterators held by the caller
+             * @param budget Maximum number of nodes moved by this call
+             * @return True if the compaction is finished (or the tree was already
+             * compact), False if more steps are needed
+             */
+            bool CompactStep(std::size_t budget);
     };
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    RedBlackTree<typeT, lessComparator, equalComparator>::RedBlackTree(
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::RedBlackTree(
         const lessComparator&  lessComp,
         const equalComparator& equalComp)
         : m_lessComp(lessComp),
           m_equalComp(equalComp)
     {
-        this->m_root     = nullptr;
-        this->m_numNodes = 0;
-    }
+        this->m_root      = nullptr;
+        this->m_rightmost = nullptr;
+        this->m_numNodes  = 0;
+        this->m_multi     = false;
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    RedBlackTree<typeT, lessComparator, equalComparator>::~RedBlackTree()
-    {
-        this->Clear();
+        this->m_validationInterval = 0;
+        this->m_mutations          = 0;
+        this->m_sampleState        = 0x9E3779B97F4A7C15ULL;
+
+        this->m_compactCursor = nullptr;
+        this->m_compactArena  = nullptr;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    Node<typeT>*
-    RedBlackTree<typeT, lessComparator, equalComparator>::Insert(const typeT& key)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::RedBlackTree(
+        const RedBlackTree& other)
+        : RedBlackTree(other.m_lessComp, other.m_equalComp)
     {
-        if (this->m_root == nullptr)
+        this->m_validationInterval = other.m_validationInterval;
+        this->m_multi              = other.m_multi;
+
+        std::size_t size  = other.Size();
+        NodeArena*  arena = nullptr;
+
+        if (size == 0)
+            return;
+
+        if constexpr (IS_RELOCATABLE)
         {
-            this->m_root = new Node<typeT>(key);
-            this->m_numNodes++;
-            this->m_root->SetColor(BLACK);
-            return this->m_root;
+            this->m_arenas.push_back(std::make_shared<NodeArena>(size));
+            arena = this->m_arenas.front().get();
         }
-        else if (this->m_equalComp(m_root->GetValue(), key))
+
+        try
         {
-            return m_root;
+            this->m_root = this->Clone(other.m_root, nullptr, arena);
         }
-        else
+        catch (...)
         {
-            if (this->m_lessComp(key, this->m_root->GetValue()))
-                return this->Insert(this->m_root, this->m_root->GetLeftNode(), key);
-
-            else
-                return this->Insert(this->m_root, this->m_root->GetRightNode(), key);
+            this->Clear();
+            throw;
         }
+
+        this->m_numNodes = size;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    Node<typeT>*
-    RedBlackTree<typeT, lessComparator, equalComparator>::Insert(Node<typeT>*  parent,
-                                                                 Node<typeT>*& node,
-                                                                 const typeT&  key)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::RedBlackTree(
+        RedBlackTree&& other)
+        : RedBlackTree(other.m_lessComp, other.m_equalComp)
     {
-        if (node == nullptr)
-        {
-            this->m_numNodes++;
-            // FixInsert modifies the pointer, so create a temporary one for returning
-            // purposes
-            Node<typeT>* newNode = new Node<typeT>(key, parent);
-            node                 = newNode;
-            this->FixInsert(node);
-            return newNode;
-        }
-        else if (this->m_equalComp(node->GetValue(), key))
+        this->Swap(other);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::~RedBlackTree()
+    {
+        this->Clear();
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>&
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::operator=(
+        const RedBlackTree& other)
+    {
+        if (this == &other)
+            return *this;
+
+        // The copy is built before anything is released
+        RedBlackTree copy(other);
+        this->Swap(copy);
+
+        return *this;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>&
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::operator=(
+        RedBlackTree&& other)
+    {
+        if (this == &other)
+            return *this;
+
+        this->Clear();
+        this->Swap(other);
+
+        return *this;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Swap(
+        RedBlackTree& other)
+    {
+        std::swap(this->m_root, other.m_root);
+        std::swap(this->m_rightmost, other.m_rightmost);
+        std::swap(this->m_numNodes, other.m_numNodes);
+        std::swap(this->m_multi, other.m_multi);
+        std::swap(this->m_lessComp, other.m_lessComp);
+        std::swap(this->m_equalComp, other.m_equalComp);
+        std::swap(this->m_validationInterval, other.m_validationInterval);
+        std::swap(this->m_mutations, other.m_mutations);
+        std::swap(this->m_sampleState, other.m_sampleState);
+        std::swap(this->m_arenas, other.m_arenas);
+        std::swap(this->m_compactCursor, other.m_compactCursor);
+        std::swap(this->m_compactArena, other.m_compactArena);
+        std::swap(this->m_graveyard, other.m_graveyard);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>* RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Clone(
+        nodeT<typeT>* node,
+        nodeT<typeT>* parent,
+        NodeArena*    arena)
+    {
+        if (node == nullptr)
+            return nullptr;
+
+        nodeT<typeT>* left = this->Clone(node->GetLeftNode(), nullptr, arena);
+        nodeT<typeT>* copy;
+
+        // If copying a key throws, every node copied so far is linked below 'left'
+        // or 'copy', and is freed before the exception goes up
+        try
+        {
+            if (arena != nullptr)
+            {
+                copy = arena->nodes + arena->used;
+                ::new (copy) nodeT<typeT>(node->GetValue(), parent);
+                arena->used++;
+                arena->live.fetch_add(1, std::memory_order_relaxed);
+                RBTREE_COUNT(allocations, 1);
+            }
+            else
+                copy = this->NewNode(node->GetValue(), parent);
+        }
+        catch (...)
+        {
+            this->Clear(left);
+            throw;
+        }
+
+        copy->SetColor(node->GetColor());
+        copy->SetLeftNode(left);
+
+        if (left != nullptr)
+            left->SetParent(copy);
+
+        try
+        {
+            copy->SetRightNode(this->Clone(node->GetRightNode(), copy, arena));
+        }
+        catch (...)
+        {
+            this->Clear(copy);
+            throw;
+        }
+
+        return copy;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    bool RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Less(
+        const typeT& a, const typeT& b)
+    {
+        RBTREE_COUNT(comparisons, 1);
+        return this->m_lessComp(a, b);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    bool RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Equal(
+        const typeT& a, const typeT& b)
+    {
+        RBTREE_COUNT(comparisons, 1);
+        return this->m_equalComp(a, b);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::NewNode(
+        const typeT& key, nodeT<typeT>* parent)
+    {
+        RBTREE_COUNT(allocations, 1);
+        return new nodeT<typeT>(key, parent);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::FreeNode(
+        nodeT<typeT>* node)
+    {
+        RBTREE_COUNT(deallocations, 1);
+
+        // Nodes in an arena are destroyed in place. Their slot is released with the
+        // whole arena
+        NodeArena* arena = this->FindArena(node);
+
+        if (arena == nullptr)
+        {
+            delete node;
+            return;
+        }
+
+        std::destroy_at(node);
+        arena->live.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Augment(
+        nodeT<typeT>* node)
+    {
+        if constexpr (IS_AUGMENTED)
+        {
+            nodeT<typeT>* left  = node->GetLeftNode();
+            nodeT<typeT>* right = node->GetRightNode();
+
+            node->GetValue().Augment(left ? &left->GetValue() : nullptr,
+                                     right ? &right->GetValue() : nullptr);
+        }
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::AugmentPath(
+        nodeT<typeT>* node)
+    {
+        if constexpr (IS_AUGMENTED)
+        {
+            for (; node != nullptr; node = node->GetParent())
+                this->Augment(node);
+        }
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Recolor(
+        nodeT<typeT>* node, Color color)
+    {
+        if (node->GetColor() != color)
+            RBTREE_COUNT(recolors, 1);
+
+        node->SetColor(color);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Insert(
+        const typeT& key)
+    {
+        RBTREE_COUNT(operations, 1);
+        return this->Insert(nullptr, this->m_root, key);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Insert(
+        nodeT<typeT>* parent, nodeT<typeT>* node, const typeT& key)
+    {
+        if (node == nullptr)
+            return this->Link(parent,
+                              parent != nullptr and this->Less(key, parent->GetValue()),
+                              key);
+
+        else if (this->Equal(node->GetValue(), key))
         {
             return node;
         }
         else
         {
-            if (this->m_lessComp(key, node->GetValue()))
+            if (this->Less(key, node->GetValue()))
                 return this->Insert(node, node->GetLeftNode(), key);
 
             else
@@ -297,13 +1267,271 @@ namespace rbtree
         }
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Link(
+        nodeT<typeT>* parent, bool isLeft, const typeT& key)
+    {
+        this->m_numNodes++;
+        // Nodes are linked through the setters, since compact layouts cannot hand
+        // out references to their child links
+        nodeT<typeT>* newNode = this->NewNode(key, parent);
+
+        if (parent == nullptr)
+            this->m_root = newNode;
+        else if (isLeft)
+            parent->SetLeftNode(newNode);
+        else
+        {
+            parent->SetRightNode(newNode);
+
+            // Rotations keep the in-order sequence, so only a right child of the
+            // rightmost node can take its place
+            if (parent == this->m_rightmost)
+                this->m_rightmost = newNode;
+        }
+
+        this->AugmentPath(parent);
+        this->FixInsert(newNode);
+        this->CountMutation();
+        return newNode;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::GetRightmost()
+    {
+        if (this->m_rightmost == nullptr and this->m_root != nullptr)
+        {
+            this->m_rightmost = this->m_root;
+
+            while (this->m_rightmost->GetRightNode() != nullptr)
+                this->m_rightmost = this->m_rightmost->GetRightNode();
+        }
+
+        return this->m_rightmost;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Insert(
+        nodeT<typeT>* hint, const typeT& key)
+    {
+        if (hint == nullptr)
+            return this->Append(key);
+
+        RBTREE_COUNT(operations, 1);
+
+        if (this->Equal(hint->GetValue(), key))
+            return hint;
+
+        if (this->Less(hint->GetValue(), key))
+        {
+            // The key belongs right after the hint if it is smaller than the
+            // successor. The new node then goes on the first free link between them
+            nodeT<typeT>* next = this->FindSuccessor(hint);
+
+            if (next != nullptr and not this->Less(key, next->GetValue()))
+            {
+                if (this->Equal(next->GetValue(), key))
+                    return next;
+
+                return this->Insert(nullptr, this->m_root, key);
+            }
+
+            if (hint->GetRightNode() == nullptr)
+                return this->Link(hint, false, key);
+
+            return this->Link(next, true, key);
+        }
+
+        nodeT<typeT>* prev = this->FindPredecessor(hint);
+
+        if (prev != nullptr and not this->Less(prev->GetValue(), key))
+        {
+            if (this->Equal(prev->GetValue(), key))
+                return prev;
+
+            return this->Insert(nullptr, this->m_root, key);
+        }
+
+        if (hint->GetLeftNode() == nullptr)
+            return this->Link(hint, true, key);
+
+        return this->Link(prev, false, key);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Append(
+        const typeT& key)
+    {
+        RBTREE_COUNT(operations, 1);
+
+        nodeT<typeT>* last = this->GetRightmost();
+
+        if (last == nullptr or not this->Less(last->GetValue(), key))
+            return this->Insert(nullptr, this->m_root, key);
+
+        return this->Link(last, false, key);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::InsertMulti(
+        const typeT& key)
+    {
+        RBTREE_COUNT(operations, 1);
+
+        nodeT<typeT>* parent = nullptr;
+        nodeT<typeT>* node   = this->m_root;
+        bool          isLeft = false;
+
+        this->m_multi = true;
+
+        // Equal keys go to the right, after the copies already in the tree
+        while (node != nullptr)
+        {
+            parent = node;
+            isLeft = this->Less(key, node->GetValue());
+            node   = isLeft ? node->GetLeftNode() : node->GetRightNode();
+        }
+
+        return this->Link(parent, isLeft, key);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    std::size_t
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Count(
+        const typeT& key)
+    {
+        RBTREE_COUNT(operations, 1);
+
+        std::size_t count = 0;
+
+        for (nodeT<typeT>* node = this->LowerBound(key);
+             node != nullptr and this->Equal(node->GetValue(), key);
+             node = this->FindSuccessor(node))
+            count++;
+
+        return count;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    Pair<nodeT<typeT>*, nodeT<typeT>*>
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::EqualRange(
+        const typeT& key)
+    {
+        RBTREE_COUNT(operations, 1);
+
+        return Pair<nodeT<typeT>*, nodeT<typeT>*>(this->LowerBound(key),
+                                                  this->UpperBound(key));
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Next(
+        nodeT<typeT>* node)
+    {
+        return this->FindSuccessor(node);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::LowerBound(
+        const typeT& key)
+    {
+        nodeT<typeT>* bound = nullptr;
+        nodeT<typeT>* node  = this->m_root;
+
+        while (node != nullptr)
+        {
+            if (this->Less(node->GetValue(), key))
+                node = node->GetRightNode();
+            else
+            {
+                bound = node;
+                node  = node->GetLeftNode();
+            }
+        }
+
+        return bound;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::UpperBound(
+        const typeT& key)
+    {
+        nodeT<typeT>* bound = nullptr;
+        nodeT<typeT>* node  = this->m_root;
+
+        while (node != nullptr)
+        {
+            if (this->Less(key, node->GetValue()))
+            {
+                bound = node;
+                node  = node->GetLeftNode();
+            }
+            else
+                node = node->GetRightNode();
+        }
+
+        return bound;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
     void
-    RedBlackTree<typeT, lessComparator, equalComparator>::FixInsert(Node<typeT>* node)
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::FixInsert(
+        nodeT<typeT>* node)
+    {
+        this->FixInsert(node, this->m_root);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    bool
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::FixInsert(
+        nodeT<typeT>* node, nodeT<typeT>*& root)
     {
-        Node<typeT>* uncle = nullptr;
+        nodeT<typeT>* uncle = nullptr;
 
-        while (node != this->m_root and node->GetParent() and
+        while (node != root and node->GetParent() and
                node->GetParent()->GetColor() == RED)
         {
             if (node->GetParent() == node->GetParent()->GetParent()->GetRightNode())
@@ -313,9 +1541,9 @@ namespace rbtree
 
                 if (uncle and uncle->GetColor() == RED)
                 {
-                    uncle->SetColor(BLACK);
-                    node->GetParent()->SetColor(BLACK);
-                    node->GetParent()->GetParent()->SetColor(RED);
+                    this->Recolor(uncle, BLACK);
+                    this->Recolor(node->GetParent(), BLACK);
+                    this->Recolor(node->GetParent()->GetParent(), RED);
                     node = node->GetParent()->GetParent();
                 }
                 else
@@ -323,11 +1551,11 @@ namespace rbtree
                     if (node == node->GetParent()->GetLeftNode())
                     {
                         node = node->GetParent();
-                        this->RotateRight(node);
+                        this->RotateRight(node, root);
                     }
-                    node->GetParent()->SetColor(BLACK);
-                    node->GetParent()->GetParent()->SetColor(RED);
-                    this->RotateLeft(node->GetParent()->GetParent());
+                    this->Recolor(node->GetParent(), BLACK);
+                    this->Recolor(node->GetParent()->GetParent(), RED);
+                    this->RotateLeft(node->GetParent()->GetParent(), root);
                 }
             }
             else
@@ -336,9 +1564,9 @@ namespace rbtree
 
                 if (uncle and uncle->GetColor() == RED)
                 {
-                    uncle->SetColor(BLACK);
-                    node->GetParent()->SetColor(BLACK);
-                    node->GetParent()->GetParent()->SetColor(RED);
+                    this->Recolor(uncle, BLACK);
+                    this->Recolor(node->GetParent(), BLACK);
+                    this->Recolor(node->GetParent()->GetParent(), RED);
                     node = node->GetParent()->GetParent();
                 }
                 else
@@ -346,73 +1574,128 @@ namespace rbtree
                     if (node == node->GetParent()->GetRightNode())
                     {
                         node = node->GetParent();
-                        this->RotateLeft(node);
+                        this->RotateLeft(node, root);
                     }
-                    node->GetParent()->SetColor(BLACK);
-                    node->GetParent()->GetParent()->SetColor(RED);
-                    this->RotateRight(node->GetParent()->GetParent());
+                    this->Recolor(node->GetParent(), BLACK);
+                    this->Recolor(node->GetParent()->GetParent(), RED);
+                    this->RotateRight(node->GetParent()->GetParent(), root);
                 }
             }
         }
-        this->m_root->SetColor(BLACK);
+
+        bool grew = root->GetColor() == RED;
+        this->Recolor(root, BLACK);
+
+        return grew;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    std::size_t RedBlackTree<typeT, lessComparator, equalComparator>::Size() const
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    std::size_t
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Size() const
     {
         return this->m_numNodes;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    bool RedBlackTree<typeT, lessComparator, equalComparator>::IsEmpty()
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    bool RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::IsEmpty()
+    {
+        return (this->m_root == nullptr);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Remove(
+        const typeT& key)
     {
-        return (this->m_numNodes == 0);
+        RBTREE_COUNT(operations, 1);
+        this->DeleteNode(this->Search(this->m_root, key));
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    void RedBlackTree<typeT, lessComparator, equalComparator>::Remove(const typeT& key)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    std::size_t
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::RemoveAll(
+        const typeT& key)
     {
-        this->DeleteNode(this->Search(key));
+        RBTREE_COUNT(operations, 1);
+
+        std::size_t   removed = 0;
+        nodeT<typeT>* node    = this->LowerBound(key);
+
+        // DeleteNode relinks nodes instead of moving keys, so the successor taken
+        // before a removal is still the next copy after it
+        while (node != nullptr and this->Equal(node->GetValue(), key))
+        {
+            nodeT<typeT>* next = this->FindSuccessor(node);
+
+            this->DeleteNode(node);
+            node = next;
+            removed++;
+        }
+
+        return removed;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
     void
-    RedBlackTree<typeT, lessComparator, equalComparator>::DeleteNode(Node<typeT>* node)
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::DeleteNode(
+        nodeT<typeT>* node)
     {
         if (node == nullptr)
             return;
 
-        Node<typeT>* aux;
-        Color        nodeColor = node->GetColor();
+        if (node == this->m_rightmost)
+            this->m_rightmost = nullptr;
+
+        if (node == this->m_compactCursor)
+            this->m_compactCursor = this->FindSuccessor(node);
+
+        nodeT<typeT>* aux;
+        nodeT<typeT>* auxParent;
+        Color         nodeColor = node->GetColor();
 
         if (node->GetLeftNode() == nullptr) // Case 1: node has no left child
         {
-            aux = node->GetRightNode();
+            aux       = node->GetRightNode();
+            auxParent = node->GetParent();
             this->Transplant(node, node->GetRightNode());
         }
         else if (node->GetRightNode() == nullptr) // Case 2: node has no right child
         {
-            aux = node->GetLeftNode();
+            aux       = node->GetLeftNode();
+            auxParent = node->GetParent();
             this->Transplant(node, node->GetLeftNode());
         }
         else // Case 3: node has two children
         {
+            nodeT<typeT>* nodeCopy = this->FindSuccessor(node);
+            nodeColor              = nodeCopy->GetColor();
+            aux                    = nodeCopy->GetRightNode();
 
-            Node<typeT>* nodeCopy = this->FindSuccessor(node);
-            nodeColor             = nodeCopy->GetColor();
-            aux                   = nodeCopy->GetRightNode();
-
-            if (aux and nodeCopy->GetParent() == node)
+            if (nodeCopy->GetParent() == node)
             {
-                aux->SetParent(nodeCopy);
+                auxParent = nodeCopy;
             }
             else
             {
+                auxParent = nodeCopy->GetParent();
                 this->Transplant(nodeCopy, nodeCopy->GetRightNode());
                 nodeCopy->SetRightNode(node->GetRightNode());
-
-                if (nodeCopy->GetRightNode() and nodeCopy->GetRightNode()->GetParent())
-                    nodeCopy->GetRightNode()->SetParent(nodeCopy);
+                nodeCopy->GetRightNode()->SetParent(nodeCopy);
             }
 
             this->Transplant(node, nodeCopy);
@@ -423,128 +1706,128 @@ namespace rbtree
         }
 
         this->m_numNodes--;
+        this->AugmentPath(auxParent);
 
         if (nodeColor == BLACK)
-            this->FixDelete(aux);
+            this->FixDelete(aux, auxParent);
 
-        delete node;
+        this->FreeNode(node);
+        this->CountMutation();
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
     void
-    RedBlackTree<typeT, lessComparator, equalComparator>::FixDelete(Node<typeT>* node)
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::FixDelete(
+        nodeT<typeT>* node, nodeT<typeT>* parent)
     {
-        Node<typeT>* aux = nullptr;
+        nodeT<typeT>* aux = nullptr;
 
-        while (node != this->m_root and node and node->GetColor() == BLACK)
+        // Null nodes are black, so 'node' may be null here. That is why its parent is
+        // tracked separately
+        while (node != this->m_root and (node == nullptr or node->GetColor() == BLACK))
         {
-            if (node == node->GetParent()->GetLeftNode())
+            if (node == parent->GetLeftNode())
             {
-                aux = node->GetParent()->GetRightNode();
+                aux = parent->GetRightNode();
 
-                if (aux != nullptr)
+                if (aux->GetColor() == RED)
                 {
-                    if (aux->GetColor() == RED)
-                    {
-                        aux->SetColor(BLACK);
-                        node->GetParent()->SetColor(RED);
-                        this->RotateLeft(node->GetParent());
-                        aux = node->GetParent()->GetRightNode();
-                    }
-                    else if (aux->GetLeftNode() and
-                             aux->GetLeftNode()->GetColor() == BLACK and
-                             aux->GetRightNode() and
-                             aux->GetRightNode()->GetColor() == BLACK)
-                    {
-                        aux->SetColor(RED);
-                        node = node->GetParent();
-                    }
-                    else if (aux->GetRightNode() and
-                             aux->GetRightNode()->GetColor() == BLACK and
-                             aux->GetLeftNode())
-                    {
-                        aux->GetLeftNode()->SetColor(BLACK);
-                        aux->SetColor(RED);
-                        this->RotateRight(aux);
-                        aux = node->GetParent()->GetRightNode();
-                    }
-                    else
-                    {
-                        aux->SetColor(node->GetParent()->GetColor());
-                        node->GetParent()->SetColor(BLACK);
-
-                        if (aux->GetRightNode())
-                            aux->GetRightNode()->SetColor(BLACK);
+                    this->Recolor(aux, BLACK);
+                    this->Recolor(parent, RED);
+                    this->RotateLeft(parent);
+                    aux = parent->GetRightNode();
+                }
 
-                        this->RotateLeft(node->GetParent());
-                        node = this->m_root;
-                    }
+                if (this->IsBlack(aux->GetLeftNode()) and
+                    this->IsBlack(aux->GetRightNode()))
+                {
+                    this->Recolor(aux, RED);
+                    node   = parent;
+                    parent = node->GetParent();
                 }
                 else
                 {
-                    break;
+                    if (this->IsBlack(aux->GetRightNode()))
+                    {
+                        this->Recolor(aux->GetLeftNode(), BLACK);
+                        this->Recolor(aux, RED);
+                        this->RotateRight(aux);
+                        aux = parent->GetRightNode();
+                    }
+
+                    this->Recolor(aux, parent->GetColor());
+                    this->Recolor(parent, BLACK);
+                    this->Recolor(aux->GetRightNode(), BLACK);
+                    this->RotateLeft(parent);
+                    node = this->m_root;
                 }
             }
             else
             {
-                aux = node->GetParent()->GetLeftNode();
+                aux = parent->GetLeftNode();
 
-                if (aux != nullptr)
+                if (aux->GetColor() == RED)
                 {
-                    if (aux->GetColor() == RED)
-                    {
-                        aux->SetColor(BLACK);
-                        node->GetParent()->SetColor(RED);
-                        this->RotateRight(node->GetParent());
-                        aux = node->GetParent()->GetLeftNode();
-                    }
-                    else if (aux->GetLeftNode() and
-                             aux->GetLeftNode()->GetColor() == BLACK and
-                             aux->GetRightNode() and
-                             aux->GetRightNode()->GetColor() == BLACK)
-                    {
-                        aux->SetColor(RED);
-                        node = node->GetParent();
-                    }
-                    else if (aux->GetLeftNode() and
-                             aux->GetLeftNode()->GetColor() == BLACK and
-                             aux->GetRightNode())
-                    {
-                        aux->GetRightNode()->SetColor(BLACK);
-                        aux->SetColor(RED);
-                        this->RotateLeft(aux);
-                        aux = node->GetParent()->GetLeftNode();
-                    }
-                    else
-                    {
-                        aux->SetColor(node->GetParent()->GetColor());
-                        node->GetParent()->SetColor(BLACK);
-
-                        if (aux->GetLeftNode())
-                            aux->GetLeftNode()->SetColor(BLACK);
+                    this->Recolor(aux, BLACK);
+                    this->Recolor(parent, RED);
+                    this->RotateRight(parent);
+                    aux = parent->GetLeftNode();
+                }
 
-                        this->RotateRight(node->GetParent());
-                        node = this->m_root;
-                    }
+                if (this->IsBlack(aux->GetLeftNode()) and
+                    this->IsBlack(aux->GetRightNode()))
+                {
+                    this->Recolor(aux, RED);
+                    node   = parent;
+                    parent = node->GetParent();
                 }
                 else
                 {
-                    break;
+                    if (this->IsBlack(aux->GetLeftNode()))
+                    {
+                        this->Recolor(aux->GetRightNode(), BLACK);
+                        this->Recolor(aux, RED);
+                        this->RotateLeft(aux);
+                        aux = parent->GetLeftNode();
+                    }
+
+                    this->Recolor(aux, parent->GetColor());
+                    this->Recolor(parent, BLACK);
+                    this->Recolor(aux->GetLeftNode(), BLACK);
+                    this->RotateRight(parent);
+                    node = this->m_root;
                 }
             }
         }
 
         if (node != nullptr)
-            node->SetColor(BLACK);
+            this->Recolor(node, BLACK);
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    void RedBlackTree<typeT, lessComparator, equalComparator>::Transplant(
-        Node<typeT>*& node1,
-        Node<typeT>*& node2)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    bool
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::IsBlack(
+        nodeT<typeT>* node)
     {
-        if (node1->GetParent() == nullptr)
-            this->m_root = node2;
+        return node == nullptr or node->GetColor() == BLACK;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Transplant(
+        nodeT<typeT>* node1,
+        nodeT<typeT>* node2)
+    {
+        if (node1->GetParent() == nullptr)
+            this->m_root = node2;
 
         else if (node1 == node1->GetParent()->GetLeftNode())
             node1->GetParent()->SetLeftNode(node2);
@@ -556,36 +1839,61 @@ namespace rbtree
             node2->SetParent(node1->GetParent());
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    Node<typeT>*
-    RedBlackTree<typeT, lessComparator, equalComparator>::Search(const typeT& key)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Search(
+        const typeT& key)
     {
+        RBTREE_COUNT(operations, 1);
         return this->Search(this->m_root, key);
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    Node<typeT>*
-    RedBlackTree<typeT, lessComparator, equalComparator>::Search(Node<typeT>* node,
-                                                                 const typeT& key)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Search(
+        nodeT<typeT>* node, const typeT& key)
     {
-        if (node == nullptr or this->m_equalComp(key, node->GetValue()))
+        if (node == nullptr or this->Equal(key, node->GetValue()))
             return node;
 
-        if (this->m_lessComp(key, node->GetValue()))
+        if (this->Less(key, node->GetValue()))
             return this->Search(node->GetLeftNode(), key);
 
         else
             return this->Search(node->GetRightNode(), key);
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    Node<typeT>*
-    RedBlackTree<typeT, lessComparator, equalComparator>::RotateLeft(Node<typeT>* node)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::RotateLeft(
+        nodeT<typeT>* node)
+    {
+        return this->RotateLeft(node, this->m_root);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::RotateLeft(
+        nodeT<typeT>* node, nodeT<typeT>*& root)
     {
         if (node == nullptr or node->GetRightNode() == nullptr)
             return node;
 
-        Node<typeT>* pivot = node->GetRightNode();
+        RBTREE_COUNT(rotations, 1);
+
+        nodeT<typeT>* pivot = node->GetRightNode();
         node->SetRightNode(pivot->GetLeftNode());
 
         if (pivot->GetLeftNode() != nullptr)
@@ -594,7 +1902,7 @@ namespace rbtree
         pivot->SetParent(node->GetParent());
 
         if (node->GetParent() == nullptr)
-            this->m_root = pivot;
+            root = pivot;
 
         else if (node == node->GetParent()->GetLeftNode())
             node->GetParent()->SetLeftNode(pivot);
@@ -605,17 +1913,38 @@ namespace rbtree
         pivot->SetLeftNode(node);
         node->SetParent(pivot);
 
+        // Only the rotated nodes changed children
+        this->Augment(node);
+        this->Augment(pivot);
+
         return pivot;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    Node<typeT>*
-    RedBlackTree<typeT, lessComparator, equalComparator>::RotateRight(Node<typeT>* node)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::RotateRight(
+        nodeT<typeT>* node)
+    {
+        return this->RotateRight(node, this->m_root);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::RotateRight(
+        nodeT<typeT>* node, nodeT<typeT>*& root)
     {
         if (node == nullptr or node->GetLeftNode() == nullptr)
             return node;
 
-        Node<typeT>* pivot = node->GetLeftNode();
+        RBTREE_COUNT(rotations, 1);
+
+        nodeT<typeT>* pivot = node->GetLeftNode();
         node->SetLeftNode(pivot->GetRightNode());
 
         if (pivot->GetRightNode() != nullptr)
@@ -624,7 +1953,7 @@ namespace rbtree
         pivot->SetParent(node->GetParent());
 
         if (node->GetParent() == nullptr)
-            this->m_root = pivot;
+            root = pivot;
 
         else if (node == node->GetParent()->GetLeftNode())
             node->GetParent()->SetLeftNode(pivot);
@@ -635,12 +1964,20 @@ namespace rbtree
         pivot->SetRightNode(node);
         node->SetParent(pivot);
 
+        // Only the rotated nodes changed children
+        this->Augment(node);
+        this->Augment(pivot);
+
         return pivot;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    Node<typeT>* RedBlackTree<typeT, lessComparator, equalComparator>::MoveRed2Left(
-        Node<typeT>* node)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::MoveRed2Left(
+        nodeT<typeT>* node)
     {
         this->ChangeFamilyColor(node);
 
@@ -656,9 +1993,13 @@ namespace rbtree
         return node;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    Node<typeT>* RedBlackTree<typeT, lessComparator, equalComparator>::MoveRed2Right(
-        Node<typeT>* node)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::MoveRed2Right(
+        nodeT<typeT>* node)
     {
         this->ChangeFamilyColor(node);
 
@@ -673,26 +2014,33 @@ namespace rbtree
         return node;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    void RedBlackTree<typeT, lessComparator, equalComparator>::ChangeFamilyColor(
-        Node<typeT>* parent)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::ChangeFamilyColor(
+        nodeT<typeT>* parent)
     {
-        parent->SetColor(parent->GetColor() == BLACK ? RED : BLACK);
+        this->Recolor(parent, parent->GetColor() == BLACK ? RED : BLACK);
 
         if (parent->GetLeftNode() != nullptr)
-            parent->GetLeftNode()->SetColor(
-                parent->GetLeftNode()->GetColor() == BLACK ? RED : BLACK);
+            this->Recolor(parent->GetLeftNode(),
+                          parent->GetLeftNode()->GetColor() == BLACK ? RED : BLACK);
 
         if (parent->GetRightNode() != nullptr)
-            parent->GetRightNode()->SetColor(
-                parent->GetRightNode()->GetColor() == BLACK ? RED : BLACK);
+            this->Recolor(parent->GetRightNode(),
+                          parent->GetRightNode()->GetColor() == BLACK ? RED : BLACK);
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    Node<typeT>* RedBlackTree<typeT, lessComparator, equalComparator>::FindSuccessor(
-        Node<typeT>* node)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::FindSuccessor(
+        nodeT<typeT>* node)
     {
-        Node<typeT>* successor = nullptr;
+        nodeT<typeT>* successor = nullptr;
 
         if (node->GetRightNode() != nullptr)
         {
@@ -703,7 +2051,7 @@ namespace rbtree
         }
         else
         {
-            Node<typeT>* parent = node->GetParent();
+            nodeT<typeT>* parent = node->GetParent();
             while (parent != nullptr and node == parent->GetRightNode())
             {
                 node   = parent;
@@ -715,18 +2063,57 @@ namespace rbtree
         return successor;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    Node<typeT>*
-    RedBlackTree<typeT, lessComparator, equalComparator>::DeleteLeftMostNode(
-        Node<typeT>* node)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::FindPredecessor(
+        nodeT<typeT>* node)
+    {
+        if (node->GetLeftNode() != nullptr)
+        {
+            node = node->GetLeftNode();
+
+            while (node->GetRightNode() != nullptr)
+                node = node->GetRightNode();
+
+            return node;
+        }
+
+        nodeT<typeT>* parent = node->GetParent();
+
+        while (parent != nullptr and node == parent->GetLeftNode())
+        {
+            node   = parent;
+            parent = parent->GetParent();
+        }
+
+        return parent;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::DeleteLeftMostNode(
+        nodeT<typeT>* node)
     {
         if (node == nullptr)
             return nullptr;
 
         if (node->GetLeftNode() == nullptr)
         {
-            Node<typeT>* rightChild = node->GetRightNode();
-            delete node;
+            nodeT<typeT>* rightChild = node->GetRightNode();
+
+            if (node == this->m_rightmost)
+                this->m_rightmost = nullptr;
+
+            if (node == this->m_compactCursor)
+                this->m_compactCursor = this->FindSuccessor(node);
+
+            this->FreeNode(node);
             this->m_numNodes--;
             return rightChild;
         }
@@ -739,18 +2126,98 @@ namespace rbtree
         }
 
         node->SetLeftNode(DeleteLeftMostNode(node->GetLeftNode()));
-        this->FixDelete(node);
+        this->FixDelete(node, node->GetParent());
+
+        return node;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    void RedBlackTree<typeT, lessComparator, equalComparator>::Clear()
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Clear()
     {
+        this->StopCompaction();
         this->Clear(this->m_root);
-        this->m_root = nullptr;
+        this->m_root      = nullptr;
+        this->m_rightmost = nullptr;
+        this->m_numNodes  = 0;
+        this->m_multi     = false;
+
+        for (nodeT<typeT>* node : this->m_graveyard)
+            this->Clear(node);
+
+        this->m_graveyard.clear();
+        this->m_arenas.clear();
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::ClearAsync()
+    {
+        if (this->m_root == nullptr and this->m_graveyard.empty())
+            return;
+
+        // The move leaves this tree empty. Only the validation interval is a
+        // setting of this tree rather than part of its contents
+        std::size_t   interval = this->m_validationInterval;
+        RedBlackTree* detached = new RedBlackTree(std::move(*this));
+
+        this->m_validationInterval = interval;
+
+        utils::Reclaimer::Instance().Post([detached]() { delete detached; });
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    bool RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::ClearSome(
+        std::size_t budget)
+    {
+        if (this->m_graveyard.empty() and this->m_root != nullptr)
+        {
+            this->StopCompaction();
+            this->m_graveyard.push_back(this->m_root);
+
+            this->m_root      = nullptr;
+            this->m_rightmost = nullptr;
+            this->m_numNodes  = 0;
+            this->m_multi     = false;
+        }
+
+        for (; budget > 0 and not this->m_graveyard.empty(); budget--)
+        {
+            nodeT<typeT>* node = this->m_graveyard.back();
+            this->m_graveyard.pop_back();
+
+            if (node->GetLeftNode() != nullptr)
+                this->m_graveyard.push_back(node->GetLeftNode());
+
+            if (node->GetRightNode() != nullptr)
+                this->m_graveyard.push_back(node->GetRightNode());
+
+            this->FreeNode(node);
+        }
+
+        if (not this->m_graveyard.empty())
+            return false;
+
+        if (this->m_compactCursor == nullptr)
+            this->ReleaseArenas();
+
+        return true;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    void RedBlackTree<typeT, lessComparator, equalComparator>::Clear(Node<typeT>*& node)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Clear(
+        nodeT<typeT>* node)
     {
         if (node != nullptr)
         {
@@ -759,13 +2226,15 @@ namespace rbtree
 
             this->Clear(node->GetRightNode());
 
-            delete node;
-            this->m_numNodes--;
+            this->FreeNode(node);
         }
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    void RedBlackTree<typeT, lessComparator, equalComparator>::DumpTree(
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::DumpTree(
         const std::string& filename)
     {
         std::ofstream output(filename);
@@ -784,9 +2253,12 @@ namespace rbtree
         output.close();
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    void RedBlackTree<typeT, lessComparator, equalComparator>::DumpTree(
-        Node<typeT>*&      node,
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::DumpTree(
+        nodeT<typeT>*      node,
         const std::string& prefix,
         std::ofstream&     output,
         bool               isLeft,
@@ -827,61 +2299,1468 @@ namespace rbtree
         }
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    bool RedBlackTree<typeT, lessComparator, equalComparator>::IsRedBlackTreeBalanced(
-        Node<typeT>*& node)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    bool
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::IsRedBlackTreeBalanced()
+    {
+        try
+        {
+            this->Validate();
+        }
+        catch (const std::logic_error&)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Validate() const
+    {
+        if (this->m_root == nullptr)
+            return;
+
+        if (this->m_root->GetParent() != nullptr)
+            throw std::logic_error("The root has a parent");
+
+        if (this->m_root->GetColor() != BLACK)
+            throw std::logic_error("The root is red");
+
+        nodeT<typeT>* previous = nullptr;
+        std::size_t   count    = 0;
+
+        this->Validate(this->m_root, 0, previous, count);
+
+        if (count != this->m_numNodes)
+            throw std::logic_error("The tree has " + std::to_string(count) +
+                                   " nodes, but its size is " +
+                                   std::to_string(this->m_numNodes));
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    std::size_t
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Validate(
+        nodeT<typeT>*  node,
+        std::size_t    depth,
+        nodeT<typeT>*& previous,
+        std::size_t&   count) const
     {
+        // A red-black tree with n nodes is at most 2 log2(n + 1) deep. Stopping there
+        // also bounds the recursion on a corrupted, degenerate tree
+        constexpr std::size_t maxDepth = 2 * std::numeric_limits<std::size_t>::digits;
+
         if (node == nullptr)
-            return true;
+            return 0;
 
-        // 1. The root node must be black
-        if (node == m_root and node->GetColor() != BLACK)
-            return false;
+        if (depth > maxDepth)
+            throw std::logic_error("The tree is deeper than a red-black tree can be");
 
-        // 2. All nodes are either red or black
-        if (node->GetColor() != RED and node->GetColor() != BLACK)
-            return false;
+        nodeT<typeT>* left  = node->GetLeftNode();
+        nodeT<typeT>* right = node->GetRightNode();
+
+        if ((left != nullptr and left->GetParent() != node) or
+            (right != nullptr and right->GetParent() != node))
+            throw std::logic_error("A child does not point back to its parent");
+
+        if (node->GetColor() == RED and
+            ((left != nullptr and left->GetColor() == RED) or
+             (right != nullptr and right->GetColor() == RED)))
+            throw std::logic_error("A red node has a red child");
+
+        std::size_t leftHeight = this->Validate(left, depth + 1, previous, count);
+
+        // The comparators are called directly, so validation does not show up in
+        // the telemetry. Equal neighbours are only allowed once InsertMulti kept
+        // copies of a key
+        if (previous != nullptr and
+            this->m_lessComp(node->GetValue(), previous->GetValue()))
+            throw std::logic_error("The keys are out of order");
+
+        if (previous != nullptr and not this->m_multi and
+            not this->m_lessComp(previous->GetValue(), node->GetValue()))
+            throw std::logic_error("The tree has duplicate keys");
+
+        previous = node;
+        count++;
+
+        std::size_t rightHeight = this->Validate(right, depth + 1, previous, count);
+
+        if (leftHeight != rightHeight)
+            throw std::logic_error("Two paths have different black heights");
+
+        return leftHeight + (node->GetColor() == BLACK ? 1 : 0);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::ValidateSample()
+    {
+        if (this->m_root == nullptr)
+            return;
+
+        if (this->m_root->GetParent() != nullptr)
+            throw std::logic_error("The root has a parent");
+
+        if (this->m_root->GetColor() != BLACK)
+            throw std::logic_error("The root is red");
+
+        constexpr std::size_t maxDepth = 2 * std::numeric_limits<std::size_t>::digits;
+
+        // Closest ancestors on each side bound the key of every node of the path
+        nodeT<typeT>* low         = nullptr;
+        nodeT<typeT>* high        = nullptr;
+        nodeT<typeT>* node        = this->m_root;
+        std::size_t   blackHeight = 0;
+        std::size_t   depth       = 0;
+
+        while (node != nullptr)
+        {
+            if (++depth > maxDepth)
+                throw std::logic_error(
+                    "The tree is deeper than a red-black tree can be");
+
+            if ((low != nullptr and
+                 this->m_lessComp(node->GetValue(), low->GetValue())) or
+                (high != nullptr and
+                 this->m_lessComp(high->GetValue(), node->GetValue())))
+                throw std::logic_error("The keys are out of order");
+
+            // Without InsertMulti, a key can't be equal to an ancestor either
+            if (not this->m_multi and
+                ((low != nullptr and
+                  not this->m_lessComp(low->GetValue(), node->GetValue())) or
+                 (high != nullptr and
+                  not this->m_lessComp(node->GetValue(), high->GetValue()))))
+                throw std::logic_error("The tree has duplicate keys");
+
+            nodeT<typeT>* left  = node->GetLeftNode();
+            nodeT<typeT>* right = node->GetRightNode();
+
+            if ((left != nullptr and left->GetParent() != node) or
+                (right != nullptr and right->GetParent() != node))
+                throw std::logic_error("A child does not point back to its parent");
+
+            if (node->GetColor() == RED and
+                ((left != nullptr and left->GetColor() == RED) or
+                 (right != nullptr and right->GetColor() == RED)))
+                throw std::logic_error("A red node has a red child");
+
+            if (node->GetColor() == BLACK)
+                blackHeight++;
+
+            // xorshift64: one bit picks the side at each level
+            this->m_sampleState ^= this->m_sampleState << 13;
+            this->m_sampleState ^= this->m_sampleState >> 7;
+            this->m_sampleState ^= this->m_sampleState << 17;
+
+            if (this->m_sampleState & 1)
+            {
+                high = node;
+                node = left;
+            }
+            else
+            {
+                low  = node;
+                node = right;
+            }
+        }
+
+        if (blackHeight != this->GetBlackHeight(this->m_root))
+            throw std::logic_error("Two paths have different black heights");
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::SetValidationInterval(
+        std::size_t interval)
+    {
+        this->m_validationInterval = interval;
+        this->m_mutations          = 0;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::CountMutation()
+    {
+        if (this->m_validationInterval == 0 or
+            ++this->m_mutations < this->m_validationInterval)
+            return;
+
+        this->m_mutations = 0;
+        this->ValidateSample();
+    }
+
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    std::size_t
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::GetBlackHeight(
+        nodeT<typeT>* node)
+    {
+        std::size_t height = 0;
+
+        for (; node != nullptr; node = node->GetLeftNode())
+            if (node->GetColor() == BLACK)
+                height++;
+
+        return height;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    std::size_t
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::ChildHeight(
+        nodeT<typeT>* child, std::size_t height)
+    {
+        // A red child keeps the height of its parent once Detach turns it black
+        if (child != nullptr and child->GetColor() == RED)
+            return height;
+
+        return height - 1;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Detach(
+        nodeT<typeT>* node)
+    {
+        if (node != nullptr)
+        {
+            node->SetParent(nullptr);
+            node->SetColor(BLACK);
+        }
+
+        return node;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>* RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Join(
+        nodeT<typeT>* left,
+        std::size_t   leftHeight,
+        nodeT<typeT>* middle,
+        nodeT<typeT>* right,
+        std::size_t   rightHeight,
+        std::size_t&  height)
+    {
+        middle->SetParent(nullptr);
 
-        // 3. If a node is red, then both its children are black
-        if (node->GetColor() == RED)
+        if (leftHeight == rightHeight)
         {
-            if (node->GetLeftNode() and node->GetLeftNode()->GetColor() != BLACK)
-                return false;
+            middle->SetLeftNode(left);
+            middle->SetRightNode(right);
+            middle->SetColor(BLACK);
 
-            if (node->GetRightNode() and node->GetRightNode()->GetColor() != BLACK)
-                return false;
+            if (left != nullptr)
+                left->SetParent(middle);
+
+            if (right != nullptr)
+                right->SetParent(middle);
+
+            height = leftHeight + 1;
+            return middle;
         }
 
-        // 4. Every path from a node to its descendant null nodes must have the
-        // same number of black nodes
-        std::size_t leftBlackCount  = GetBlackNodeCount(node->GetLeftNode());
-        std::size_t rightBlackCount = GetBlackNodeCount(node->GetRightNode());
+        nodeT<typeT>* root    = leftHeight > rightHeight ? left : right;
+        nodeT<typeT>* parent  = nullptr;
+        nodeT<typeT>* node    = root;
+        std::size_t   taller  = comparators::Max<std::size_t>(leftHeight, rightHeight);
+        std::size_t   target  = comparators::Min<std::size_t>(leftHeight, rightHeight);
+        std::size_t   current = taller;
 
-        if (leftBlackCount != rightBlackCount)
-            return false;
+        // Walk down the inner spine of the taller tree until a black node with the
+        // same black height as the shorter tree
+        while (node != nullptr and (node->GetColor() == RED or current > target))
+        {
+            if (node->GetColor() == BLACK)
+                current--;
+
+            parent = node;
+            node   = leftHeight > rightHeight ? node->GetRightNode()
+                                                  : node->GetLeftNode();
+        }
+
+        if (leftHeight > rightHeight)
+        {
+            middle->SetLeftNode(node);
+            middle->SetRightNode(right);
+            parent->SetRightNode(middle);
+
+            if (right != nullptr)
+                right->SetParent(middle);
+        }
+        else
+        {
+            middle->SetLeftNode(left);
+            middle->SetRightNode(node);
+            parent->SetLeftNode(middle);
+
+            if (left != nullptr)
+                left->SetParent(middle);
+        }
+
+        if (node != nullptr)
+            node->SetParent(middle);
+
+        middle->SetParent(parent);
+        middle->SetColor(RED);
+
+        height = taller + (this->FixInsert(middle, root) ? 1 : 0);
+
+        return root;
+    }
 
-        return IsRedBlackTreeBalanced(node->GetLeftNode()) and
-               IsRedBlackTreeBalanced(node->GetRightNode());
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>* RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Join(
+        nodeT<typeT>* left,
+        std::size_t   leftHeight,
+        nodeT<typeT>* right,
+        std::size_t   rightHeight,
+        std::size_t&  height)
+    {
+        if (left == nullptr)
+        {
+            height = rightHeight;
+            return right;
+        }
+
+        if (right == nullptr)
+        {
+            height = leftHeight;
+            return left;
+        }
+
+        nodeT<typeT>* rest;
+        std::size_t   restHeight;
+        nodeT<typeT>* last = this->SplitLast(left, leftHeight, rest, restHeight);
+
+        return this->Join(rest, restHeight, last, right, rightHeight, height);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::SplitLast(
+        nodeT<typeT>*  node,
+        std::size_t    height,
+        nodeT<typeT>*& rest,
+        std::size_t&   restHeight)
+    {
+        std::size_t   leftHeight  = ChildHeight(node->GetLeftNode(), height);
+        std::size_t   rightHeight = ChildHeight(node->GetRightNode(), height);
+        nodeT<typeT>* left        = this->Detach(node->GetLeftNode());
+        nodeT<typeT>* right       = this->Detach(node->GetRightNode());
+
+        node->SetLeftNode(nullptr);
+        node->SetRightNode(nullptr);
+        node->SetParent(nullptr);
+
+        if (right == nullptr)
+        {
+            rest       = left;
+            restHeight = leftHeight;
+            return node;
+        }
+
+        nodeT<typeT>* last = this->SplitLast(right, rightHeight, rest, restHeight);
+        rest = this->Join(left, leftHeight, node, rest, restHeight, restHeight);
+
+        return last;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    std::size_t RedBlackTree<typeT, lessComparator, equalComparator>::GetBlackNodeCount(
-        Node<typeT>*& node)
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>* RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Split(
+        nodeT<typeT>*  node,
+        std::size_t    height,
+        const typeT&   key,
+        nodeT<typeT>*& left,
+        std::size_t&   leftHeight,
+        nodeT<typeT>*& right,
+        std::size_t&   rightHeight)
     {
         if (node == nullptr)
-            return 1; // Null nodes are black
+        {
+            left = right = nullptr;
+            leftHeight = rightHeight = 0;
+            return nullptr;
+        }
 
-        std::size_t leftCount  = GetBlackNodeCount(node->GetLeftNode());
-        std::size_t rightCount = GetBlackNodeCount(node->GetRightNode());
+        std::size_t   nodeLeftHeight  = ChildHeight(node->GetLeftNode(), height);
+        std::size_t   nodeRightHeight = ChildHeight(node->GetRightNode(), height);
+        nodeT<typeT>* nodeLeft        = this->Detach(node->GetLeftNode());
+        nodeT<typeT>* nodeRight       = this->Detach(node->GetRightNode());
+
+        node->SetLeftNode(nullptr);
+        node->SetRightNode(nullptr);
+        node->SetParent(nullptr);
+
+        if (this->Equal(key, node->GetValue()))
+        {
+            left        = nodeLeft;
+            leftHeight  = nodeLeftHeight;
+            right       = nodeRight;
+            rightHeight = nodeRightHeight;
+            return node;
+        }
+
+        nodeT<typeT>* found;
+
+        if (this->Less(key, node->GetValue()))
+        {
+            found = this->Split(
+                nodeLeft, nodeLeftHeight, key, left, leftHeight, right, rightHeight);
+            right = this->Join(
+                right, rightHeight, node, nodeRight, nodeRightHeight, rightHeight);
+        }
+        else
+        {
+            found = this->Split(
+                nodeRight, nodeRightHeight, key, left, leftHeight, right, rightHeight);
+            left = this->Join(
+                nodeLeft, nodeLeftHeight, node, left, leftHeight, leftHeight);
+        }
 
-        // If the node is black, add 1 to the count
-        return node->GetColor() == BLACK ? leftCount + 1 : rightCount;
+        return found;
     }
 
-    template<typename typeT, typename lessComparator, typename equalComparator>
-    bool RedBlackTree<typeT, lessComparator, equalComparator>::IsRedBlackTreeBalanced()
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>* RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Union(
+        nodeT<typeT>* tree1,
+        std::size_t   height1,
+        nodeT<typeT>* tree2,
+        std::size_t   height2,
+        std::size_t&  duplicates,
+        std::size_t   forkDepth,
+        std::size_t&  height)
     {
-        return this->IsRedBlackTreeBalanced(this->m_root);
+        if (tree1 == nullptr)
+        {
+            height = height2;
+            return tree2;
+        }
+
+        if (tree2 == nullptr)
+        {
+            height = height1;
+            return tree1;
+        }
+
+        std::size_t   leftHeight1  = ChildHeight(tree1->GetLeftNode(), height1);
+        std::size_t   rightHeight1 = ChildHeight(tree1->GetRightNode(), height1);
+        nodeT<typeT>* left1        = this->Detach(tree1->GetLeftNode());
+        nodeT<typeT>* right1       = this->Detach(tree1->GetRightNode());
+        nodeT<typeT>* left2;
+        nodeT<typeT>* right2;
+        std::size_t   leftHeight2;
+        std::size_t   rightHeight2;
+
+        tree1->SetLeftNode(nullptr);
+        tree1->SetRightNode(nullptr);
+
+        nodeT<typeT>* duplicate = this->Split(tree2,
+                                              height2,
+                                              tree1->GetValue(),
+                                              left2,
+                                              leftHeight2,
+                                              right2,
+                                              rightHeight2);
+
+        if (duplicate != nullptr)
+        {
+            this->FreeNode(duplicate);
+            duplicates++;
+        }
+
+        nodeT<typeT>* left;
+        nodeT<typeT>* right;
+        std::size_t   leftHeight;
+        std::size_t   rightHeight;
+
+        if (forkDepth > 0)
+        {
+            std::size_t leftDuplicates = 0;
+
+            this->Fork(
+                [&]() {
+                    left = this->Union(left1,
+                                       leftHeight1,
+                                       left2,
+                                       leftHeight2,
+                                       leftDuplicates,
+                                       forkDepth - 1,
+                                       leftHeight);
+                },
+                [&]() {
+                    right = this->Union(right1,
+                                        rightHeight1,
+                                        right2,
+                                        rightHeight2,
+                                        duplicates,
+                                        forkDepth - 1,
+                                        rightHeight);
+                });
+
+            duplicates += leftDuplicates;
+        }
+        else
+        {
+            left  = this->Union(
+                left1, leftHeight1, left2, leftHeight2, duplicates, 0, leftHeight);
+            right = this->Union(
+                right1, rightHeight1, right2, rightHeight2, duplicates, 0, rightHeight);
+        }
+
+        return this->Join(left, leftHeight, tree1, right, rightHeight, height);
     }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Intersection(
+        nodeT<typeT>* tree1,
+        std::size_t   height1,
+        nodeT<typeT>* tree2,
+        std::size_t   height2,
+        std::size_t&  kept,
+        std::size_t   forkDepth,
+        std::size_t&  height)
+    {
+        if (tree1 == nullptr or tree2 == nullptr)
+        {
+            this->Clear(tree1);
+            this->Clear(tree2);
+            height = 0;
+            return nullptr;
+        }
+
+        std::size_t   leftHeight1  = ChildHeight(tree1->GetLeftNode(), height1);
+        std::size_t   rightHeight1 = ChildHeight(tree1->GetRightNode(), height1);
+        nodeT<typeT>* left1        = this->Detach(tree1->GetLeftNode());
+        nodeT<typeT>* right1       = this->Detach(tree1->GetRightNode());
+        nodeT<typeT>* left2;
+        nodeT<typeT>* right2;
+        std::size_t   leftHeight2;
+        std::size_t   rightHeight2;
+
+        tree1->SetLeftNode(nullptr);
+        tree1->SetRightNode(nullptr);
+
+        nodeT<typeT>* duplicate = this->Split(tree2,
+                                              height2,
+                                              tree1->GetValue(),
+                                              left2,
+                                              leftHeight2,
+                                              right2,
+                                              rightHeight2);
+
+        nodeT<typeT>* left;
+        nodeT<typeT>* right;
+        std::size_t   leftHeight;
+        std::size_t   rightHeight;
+
+        if (forkDepth > 0)
+        {
+            std::size_t leftKept = 0;
+
+            this->Fork(
+                [&]() {
+                    left = this->Intersection(left1,
+                                              leftHeight1,
+                                              left2,
+                                              leftHeight2,
+                                              leftKept,
+                                              forkDepth - 1,
+                                              leftHeight);
+                },
+                [&]() {
+                    right = this->Intersection(right1,
+                                               rightHeight1,
+                                               right2,
+                                               rightHeight2,
+                                               kept,
+                                               forkDepth - 1,
+                                               rightHeight);
+                });
+
+            kept += leftKept;
+        }
+        else
+        {
+            left  = this->Intersection(
+                left1, leftHeight1, left2, leftHeight2, kept, 0, leftHeight);
+            right = this->Intersection(
+                right1, rightHeight1, right2, rightHeight2, kept, 0, rightHeight);
+        }
+
+        if (duplicate == nullptr)
+        {
+            this->FreeNode(tree1);
+            return this->Join(left, leftHeight, right, rightHeight, height);
+        }
+
+        this->FreeNode(duplicate);
+        kept++;
+
+        return this->Join(left, leftHeight, tree1, right, rightHeight, height);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Difference(
+        nodeT<typeT>* tree1,
+        std::size_t   height1,
+        nodeT<typeT>* tree2,
+        std::size_t   height2,
+        std::size_t&  removed,
+        std::size_t   forkDepth,
+        std::size_t&  height)
+    {
+        if (tree1 == nullptr or tree2 == nullptr)
+        {
+            this->Clear(tree2);
+            height = height1;
+            return tree1;
+        }
+
+        std::size_t   leftHeight2  = ChildHeight(tree2->GetLeftNode(), height2);
+        std::size_t   rightHeight2 = ChildHeight(tree2->GetRightNode(), height2);
+        nodeT<typeT>* left2        = this->Detach(tree2->GetLeftNode());
+        nodeT<typeT>* right2       = this->Detach(tree2->GetRightNode());
+        nodeT<typeT>* left1;
+        nodeT<typeT>* right1;
+        std::size_t   leftHeight1;
+        std::size_t   rightHeight1;
+
+        nodeT<typeT>* found = this->Split(tree1,
+                                          height1,
+                                          tree2->GetValue(),
+                                          left1,
+                                          leftHeight1,
+                                          right1,
+                                          rightHeight1);
+
+        this->FreeNode(tree2);
+
+        if (found != nullptr)
+        {
+            this->FreeNode(found);
+            removed++;
+        }
+
+        nodeT<typeT>* left;
+        nodeT<typeT>* right;
+        std::size_t   leftHeight;
+        std::size_t   rightHeight;
+
+        if (forkDepth > 0)
+        {
+            std::size_t leftRemoved = 0;
+
+            this->Fork(
+                [&]() {
+                    left = this->Difference(left1,
+                                            leftHeight1,
+                                            left2,
+                                            leftHeight2,
+                                            leftRemoved,
+                                            forkDepth - 1,
+                                            leftHeight);
+                },
+                [&]() {
+                    right = this->Difference(right1,
+                                             rightHeight1,
+                                             right2,
+                                             rightHeight2,
+                                             removed,
+                                             forkDepth - 1,
+                                             rightHeight);
+                });
+
+            removed += leftRemoved;
+        }
+        else
+        {
+            left  = this->Difference(
+                left1, leftHeight1, left2, leftHeight2, removed, 0, leftHeight);
+            right = this->Difference(
+                right1, rightHeight1, right2, rightHeight2, removed, 0, rightHeight);
+        }
+
+        return this->Join(left, leftHeight, right, rightHeight, height);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    std::size_t
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::GetForkDepth(
+        std::size_t numThreads)
+    {
+        std::size_t depth = 0;
+
+        while ((std::size_t(1) << depth) < numThreads)
+            depth++;
+
+        return depth;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    template<typename leftFunction, typename rightFunction>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Fork(
+        leftFunction  leftTask,
+        rightFunction rightTask)
+    {
+#ifdef RBTREE_TELEMETRY
+        TelemetryCounters counters;
+
+        std::future<void> task = std::async(std::launch::async, [&]() {
+            TelemetryCounters::Local() = &counters;
+            leftTask();
+        });
+
+        rightTask();
+        task.get();
+
+        this->m_telemetry.Target().Merge(counters);
+#else
+        std::future<void> task = std::async(std::launch::async, leftTask);
+
+        rightTask();
+        task.get();
+#endif
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Join(
+        RedBlackTree& other)
+    {
+        if (&other == this or other.m_root == nullptr)
+            return;
+
+        if (this->m_root != nullptr)
+        {
+            nodeT<typeT>* last  = this->m_root;
+            nodeT<typeT>* first = other.m_root;
+
+            while (last->GetRightNode() != nullptr)
+                last = last->GetRightNode();
+
+            while (first->GetLeftNode() != nullptr)
+                first = first->GetLeftNode();
+
+            if (not this->Less(last->GetValue(), first->GetValue()))
+                throw std::invalid_argument("Key ranges of the trees overlap");
+        }
+
+        std::size_t total = this->Size() + other.Size();
+        std::size_t height;
+
+        this->AdoptArenas(other);
+        this->m_root      = this->Join(this->m_root,
+                                       this->GetBlackHeight(this->m_root),
+                                       other.m_root,
+                                       this->GetBlackHeight(other.m_root),
+                                       height);
+        this->m_rightmost = other.m_rightmost;
+        this->m_numNodes  = total;
+        this->m_multi     = this->m_multi or other.m_multi;
+
+        other.m_root      = nullptr;
+        other.m_rightmost = nullptr;
+        other.m_numNodes  = 0;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Split(
+        const typeT& key, RedBlackTree& right)
+    {
+        if (&right == this)
+            return;
+
+        right.Clear();
+        this->StopCompaction();
+
+        std::size_t total = this->m_numNodes;
+
+        // Both trees keep nodes of the arenas
+        right.m_arenas = this->m_arenas;
+
+        std::size_t   leftHeight;
+        std::size_t   rightHeight;
+        nodeT<typeT>* found = this->Split(this->Detach(this->m_root),
+                                          this->GetBlackHeight(this->m_root),
+                                          key,
+                                          this->m_root,
+                                          leftHeight,
+                                          right.m_root,
+                                          rightHeight);
+
+        if (found != nullptr)
+            right.m_root =
+                this->Join(nullptr, 0, found, right.m_root, rightHeight, rightHeight);
+
+        // The rightmost node stays on the side that kept the greatest keys
+        right.m_rightmost = (right.m_root != nullptr) ? this->m_rightmost : nullptr;
+        right.m_multi     = this->m_multi;
+
+        if (right.m_root != nullptr)
+            this->m_rightmost = nullptr;
+
+        // Walk both sides in order at the same pace. The side that ends first is
+        // counted in O(min(k, n - k)) and the other one keeps the remaining nodes
+        nodeT<typeT>* leftNode  = this->m_root;
+        nodeT<typeT>* rightNode = right.m_root;
+        std::size_t   count     = 0;
+
+        while (leftNode != nullptr and leftNode->GetLeftNode() != nullptr)
+            leftNode = leftNode->GetLeftNode();
+
+        while (rightNode != nullptr and rightNode->GetLeftNode() != nullptr)
+            rightNode = rightNode->GetLeftNode();
+
+        while (leftNode != nullptr and rightNode != nullptr)
+        {
+            leftNode  = this->FindSuccessor(leftNode);
+            rightNode = this->FindSuccessor(rightNode);
+            count++;
+        }
+
+        this->m_numNodes = (leftNode == nullptr) ? count : total - count;
+        right.m_numNodes = total - this->m_numNodes;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Union(
+        RedBlackTree& other, std::size_t numThreads)
+    {
+        if (&other == this)
+            return;
+
+        std::size_t duplicates = 0;
+        std::size_t total      = this->Size() + other.Size();
+        std::size_t height;
+
+        this->AdoptArenas(other);
+        this->m_root = this->Union(this->m_root,
+                                   this->GetBlackHeight(this->m_root),
+                                   other.m_root,
+                                   this->GetBlackHeight(other.m_root),
+                                   duplicates,
+                                   GetForkDepth(numThreads),
+                                   height);
+
+        this->m_rightmost = nullptr;
+        this->m_numNodes  = total - duplicates;
+        this->m_multi     = this->m_multi or other.m_multi;
+
+        other.m_root      = nullptr;
+        other.m_rightmost = nullptr;
+        other.m_numNodes  = 0;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Intersection(
+        RedBlackTree& other,
+        std::size_t   numThreads)
+    {
+        if (&other == this)
+            return;
+
+        std::size_t kept = 0;
+        std::size_t height;
+
+        this->AdoptArenas(other);
+        this->m_root = this->Intersection(this->m_root,
+                                          this->GetBlackHeight(this->m_root),
+                                          other.m_root,
+                                          this->GetBlackHeight(other.m_root),
+                                          kept,
+                                          GetForkDepth(numThreads),
+                                          height);
+
+        this->m_rightmost = nullptr;
+        this->m_numNodes  = kept;
+
+        other.m_root      = nullptr;
+        other.m_rightmost = nullptr;
+        other.m_numNodes  = 0;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Difference(
+        RedBlackTree& other,
+        std::size_t   numThreads)
+    {
+        if (&other == this)
+        {
+            this->Clear();
+            return;
+        }
+
+        std::size_t removed = 0;
+        std::size_t total   = this->Size();
+        std::size_t height;
+
+        this->AdoptArenas(other);
+        this->m_root = this->Difference(this->m_root,
+                                        this->GetBlackHeight(this->m_root),
+                                        other.m_root,
+                                        this->GetBlackHeight(other.m_root),
+                                        removed,
+                                        GetForkDepth(numThreads),
+                                        height);
+
+        this->m_rightmost = nullptr;
+        this->m_numNodes  = total - removed;
+
+        other.m_root      = nullptr;
+        other.m_rightmost = nullptr;
+        other.m_numNodes  = 0;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    FrozenSet<typeT, lessComparator, equalComparator>
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Freeze()
+    {
+        nodeT<typeT>* node = this->m_root;
+
+        while (node != nullptr and node->GetLeftNode() != nullptr)
+            node = node->GetLeftNode();
+
+        auto next = [this, &node]() -> const typeT& {
+            const typeT& key = node->GetValue();
+            node             = this->FindSuccessor(node);
+            return key;
+        };
+
+        return FrozenSet<typeT, lessComparator, equalComparator>(this->Size(), next);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::SearchGroup(
+        const typeT*   keys,
+        std::size_t    count,
+        nodeT<typeT>** out)
+    {
+        nodeT<typeT>* cursor[RBTREE_BATCH_GROUP];
+
+        RBTREE_COUNT(operations, count);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            cursor[i] = this->m_root;
+            out[i]    = nullptr;
+        }
+
+        std::size_t active = count;
+
+        while (active > 0)
+        {
+            active = 0;
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                nodeT<typeT>* node = cursor[i];
+
+                if (node == nullptr)
+                    continue;
+
+                if (this->Equal(node->GetValue(), keys[i]))
+                {
+                    out[i]    = node;
+                    cursor[i] = nullptr;
+                    continue;
+                }
+
+                if (this->Less(keys[i], node->GetValue()))
+                    node = node->GetLeftNode();
+                else
+                    node = node->GetRightNode();
+
+                // The other lookups of the group run while this line is loaded
+                if (node != nullptr)
+                {
+                    __builtin_prefetch(node);
+                    active++;
+                }
+
+                cursor[i] = node;
+            }
+        }
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::BuildSorted(
+        std::span<const typeT> keys)
+    {
+        bool multi = false;
+
+        for (std::size_t i = 1; i < keys.size(); i++)
+        {
+            if (this->m_lessComp(keys[i], keys[i - 1]))
+                throw std::invalid_argument("Keys must be in ascending order");
+
+            multi = multi or not this->m_lessComp(keys[i - 1], keys[i]);
+        }
+
+        this->Clear();
+        this->m_multi = multi;
+
+        if (keys.empty())
+            return;
+
+        // Median splits leave every null link at the last two levels
+        std::size_t redDepth = std::bit_width(keys.size()) - 1;
+
+        this->m_root     = this->BuildSorted(keys, nullptr, 0, redDepth);
+        this->m_numNodes = keys.size();
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::BuildSorted(
+        std::span<const typeT> keys,
+        nodeT<typeT>*          parent,
+        std::size_t            depth,
+        std::size_t            redDepth)
+    {
+        if (keys.empty())
+            return nullptr;
+
+        std::size_t   middle = keys.size() / 2;
+        nodeT<typeT>* node   = this->NewNode(keys[middle], parent);
+
+        node->SetColor(depth == redDepth and depth > 0 ? RED : BLACK);
+        node->SetLeftNode(
+            this->BuildSorted(keys.first(middle), node, depth + 1, redDepth));
+        node->SetRightNode(
+            this->BuildSorted(keys.subspan(middle + 1), node, depth + 1, redDepth));
+
+        this->Augment(node);
+        return node;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::InsertBatch(
+        std::span<const typeT> keys)
+    {
+        std::vector<typeT> sorted(keys.begin(), keys.end());
+
+        std::sort(sorted.begin(), sorted.end(), this->m_lessComp);
+
+        nodeT<typeT>* hint = this->GetRightmost();
+
+        for (const typeT& key : sorted)
+            hint = this->Insert(hint, key);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::SearchBatch(
+        std::span<const typeT>   keys,
+        std::span<nodeT<typeT>*> out)
+    {
+        if (out.size() < keys.size())
+            throw std::invalid_argument("Output is smaller than the batch");
+
+        for (std::size_t start = 0; start < keys.size(); start += RBTREE_BATCH_GROUP)
+        {
+            std::size_t count =
+                comparators::Min<std::size_t>(RBTREE_BATCH_GROUP, keys.size() - start);
+
+            this->SearchGroup(&keys[start], count, &out[start]);
+        }
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::ContainsBatch(
+        std::span<const typeT> keys,
+        std::span<bool>        out)
+    {
+        if (out.size() < keys.size())
+            throw std::invalid_argument("Output is smaller than the batch");
+
+        nodeT<typeT>* nodes[RBTREE_BATCH_GROUP];
+
+        for (std::size_t start = 0; start < keys.size(); start += RBTREE_BATCH_GROUP)
+        {
+            std::size_t count =
+                comparators::Min<std::size_t>(RBTREE_BATCH_GROUP, keys.size() - start);
+
+            this->SearchGroup(&keys[start], count, nodes);
+
+            for (std::size_t i = 0; i < count; i++)
+                out[start + i] = nodes[i] != nullptr;
+        }
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::CollectStats(
+        nodeT<typeT>* node,
+        std::size_t   depth,
+        TreeStats&    stats) const
+    {
+        if (node == nullptr)
+            return;
+
+        if (stats.depthHistogram.size() <= depth)
+            stats.depthHistogram.resize(depth + 1, 0);
+
+        stats.depthHistogram[depth]++;
+        stats.size++;
+
+        this->CollectStats(node->GetLeftNode(), depth + 1, stats);
+        this->CollectStats(node->GetRightNode(), depth + 1, stats);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    TreeStats RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Stats() const
+    {
+        TreeStats stats;
+
+        this->CollectStats(this->m_root, 0, stats);
+
+        stats.height = stats.depthHistogram.size();
+        stats.bytes  = sizeof(*this) + stats.size * sizeof(nodeT<typeT>);
+
+        for (nodeT<typeT>* node = this->m_root; node != nullptr;
+             node               = node->GetLeftNode())
+            if (node->GetColor() == BLACK)
+                stats.blackHeight++;
+
+#ifdef RBTREE_TELEMETRY
+        stats.telemetry = this->m_telemetry.Snapshot();
+#endif
+
+        return stats;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::ResetTelemetry()
+    {
+#ifdef RBTREE_TELEMETRY
+        this->m_telemetry.Reset();
+#endif
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::NodeArena::NodeArena(
+        std::size_t capacity)
+        : nodes(std::allocator<nodeT<typeT>>().allocate(capacity)),
+          capacity(capacity),
+          used(0),
+          live(0)
+    { }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::NodeArena::~NodeArena()
+    {
+        std::allocator<nodeT<typeT>>().deallocate(this->nodes, this->capacity);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    bool
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::NodeArena::Contains(
+        const nodeT<typeT>* node) const
+    {
+        return std::less_equal<const nodeT<typeT>*>()(this->nodes, node) and
+               std::less<const nodeT<typeT>*>()(node, this->nodes + this->used);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    nodeT<typeT>*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Relocate(
+        nodeT<typeT>* node,
+        NodeArena&    arena)
+    {
+        nodeT<typeT>* parent = node->GetParent();
+        nodeT<typeT>* moved  = arena.nodes + arena.used;
+
+        ::new (moved) nodeT<typeT>(std::move(node->GetValue()), parent);
+        arena.used++;
+        arena.live.fetch_add(1, std::memory_order_relaxed);
+        RBTREE_COUNT(allocations, 1);
+
+        moved->SetColor(node->GetColor());
+        moved->SetLeftNode(node->GetLeftNode());
+        moved->SetRightNode(node->GetRightNode());
+
+        if (parent == nullptr)
+            this->m_root = moved;
+        else if (parent->GetLeftNode() == node)
+            parent->SetLeftNode(moved);
+        else
+            parent->SetRightNode(moved);
+
+        if (moved->GetLeftNode() != nullptr)
+            moved->GetLeftNode()->SetParent(moved);
+
+        if (moved->GetRightNode() != nullptr)
+            moved->GetRightNode()->SetParent(moved);
+
+        if (node == this->m_rightmost)
+            this->m_rightmost = moved;
+
+        this->FreeNode(node);
+        return moved;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::StopCompaction()
+    {
+        this->m_compactCursor = nullptr;
+        this->m_compactArena  = nullptr;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::AdoptArenas(
+        RedBlackTree& other)
+    {
+        this->StopCompaction();
+        other.StopCompaction();
+
+        for (std::shared_ptr<NodeArena>& arena : other.m_arenas)
+            this->AddArena(arena);
+
+        other.m_arenas.clear();
+
+        // Split and the set operations keep passing arenas around, so the ones
+        // whose nodes are all gone are dropped here rather than piling up
+        this->ReleaseArenas();
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::AddArena(
+        const std::shared_ptr<NodeArena>& arena)
+    {
+        auto it = std::lower_bound(
+            this->m_arenas.begin(),
+            this->m_arenas.end(),
+            arena,
+            [](const std::shared_ptr<NodeArena>& a,
+               const std::shared_ptr<NodeArena>& b) {
+                return std::less<const nodeT<typeT>*>()(a->nodes, b->nodes);
+            });
+
+        if (it == this->m_arenas.end() or *it != arena)
+            this->m_arenas.insert(it, arena);
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    typename RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::NodeArena*
+    RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::FindArena(
+        const nodeT<typeT>* node) const
+    {
+        // The last arena whose storage starts at or before the node
+        auto it = std::upper_bound(
+            this->m_arenas.begin(),
+            this->m_arenas.end(),
+            node,
+            [](const nodeT<typeT>* node, const std::shared_ptr<NodeArena>& arena) {
+                return std::less<const nodeT<typeT>*>()(node, arena->nodes);
+            });
+
+        if (it == this->m_arenas.begin() or not(*std::prev(it))->Contains(node))
+            return nullptr;
+
+        return std::prev(it)->get();
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::ReleaseArenas()
+    {
+        std::erase_if(this->m_arenas, [](const std::shared_ptr<NodeArena>& arena) {
+            return arena->live.load(std::memory_order_relaxed) == 0;
+        });
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    void RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::Compact()
+    {
+        this->StopCompaction();
+
+        while (not this->CompactStep(this->Size()))
+            ;
+    }
+
+    template<typename typeT,
+             typename lessComparator,
+             typename equalComparator,
+             template<typename> class nodeT>
+    bool RedBlackTree<typeT, lessComparator, equalComparator, nodeT>::CompactStep(
+        std::size_t budget)
+    {
+        static_assert(IS_RELOCATABLE,
+                      "Nodes with their own allocator cannot be moved into an arena");
+
+        if (this->m_compactCursor == nullptr)
+        {
+            std::size_t size = this->Size();
+
+            // Already compact: one arena holds every node, with at most half of
+            // its slots freed by removals
+            if (size == 0 or
+                (this->m_arenas.size() == 1 and
+                 this->m_arenas.back()->live.load(std::memory_order_relaxed) == size and
+                 2 * size >= this->m_arenas.back()->capacity))
+                return true;
+
+            this->ReleaseArenas();
+
+            std::shared_ptr<NodeArena> arena = std::make_shared<NodeArena>(size);
+            this->AddArena(arena);
+
+            nodeT<typeT>* first = this->m_root;
+
+            while (first->GetLeftNode() != nullptr)
+                first = first->GetLeftNode();
+
+            this->m_compactCursor = first;
+            this->m_compactArena  = arena.get();
+        }
+
+        NodeArena& arena = *this->m_compactArena;
+
+        for (; budget > 0 and this->m_compactCursor != nullptr and
+               arena.used < arena.capacity;
+             budget--)
+        {
+            nodeT<typeT>* moved   = this->Relocate(this->m_compactCursor, arena);
+            this->m_compactCursor = this->FindSuccessor(moved);
+        }
+
+        // Insertions during the compaction may leave nodes that do not fit. They
+        // stay where they are
+        if (this->m_compactCursor != nullptr and arena.used < arena.capacity)
+            return false;
+
+        this->StopCompaction();
+        this->ReleaseArenas();
+        return true;
+    }
+
 } // namespace rbtree
 #endif // RED_BLACK_TREE_H_
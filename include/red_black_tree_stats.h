@@ -0,0 +1,157 @@
+/*
+ * Filename: red_black_tree_stats.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef RED_BLACK_TREE_STATS_H_
+#define RED_BLACK_TREE_STATS_H_
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+// Telemetry is opt-in: define RBTREE_TELEMETRY for the whole build (CMake option of
+// the same name) to count rotations, recolors, comparisons and allocations. When it
+// is not defined the counters do not exist and RBTREE_COUNT expands to nothing
+#ifdef RBTREE_TELEMETRY
+#define RBTREE_COUNT(counter, amount)                                                  \
+    (this->m_telemetry.Target().counter += (amount))
+#else
+#define RBTREE_COUNT(counter, amount) ((void)0)
+#endif
+
+namespace rbtree
+{
+    /**
+     * @brief Snapshot of the telemetry counters of a tree. Every counter is zero
+     * when RBTREE_TELEMETRY is not defined
+     */
+    struct Telemetry
+    {
+        std::size_t operations    = 0; // Insertions, searches and removals
+        std::size_t comparisons   = 0; // Calls to the key comparators
+        std::size_t rotations     = 0;
+        std::size_t recolors      = 0; // Color changes while rebalancing
+        std::size_t allocations   = 0; // Nodes created
+        std::size_t deallocations = 0; // Nodes deleted
+    };
+
+    /**
+     * @brief Telemetry counters kept by a tree. The set operations rebalance
+     * subtrees in several threads at once. Instead of paying for an atomic
+     * read-modify-write on every count, each forked thread counts into its own
+     * counters, which the thread that forked it merges once the task is joined
+     */
+    struct TelemetryCounters
+    {
+        std::size_t operations    = 0;
+        std::size_t comparisons   = 0;
+        std::size_t rotations     = 0;
+        std::size_t recolors      = 0;
+        std::size_t allocations   = 0;
+        std::size_t deallocations = 0;
+
+        /**
+         * @return The counters of a forked task running in this thread, or
+         * nullptr outside of one
+         */
+        static TelemetryCounters*& Local()
+        {
+            static thread_local TelemetryCounters* local = nullptr;
+            return local;
+        }
+
+        /**
+         * @return The counters that this thread must update
+         */
+        TelemetryCounters& Target()
+        {
+            TelemetryCounters* local = Local();
+            return local != nullptr ? *local : *this;
+        }
+
+        /**
+         * @brief Add the counts of a joined task
+         */
+        void Merge(const TelemetryCounters& other)
+        {
+            this->operations    += other.operations;
+            this->comparisons   += other.comparisons;
+            this->rotations     += other.rotations;
+            this->recolors      += other.recolors;
+            this->allocations   += other.allocations;
+            this->deallocations += other.deallocations;
+        }
+
+        /**
+         * @return A copy of the current values
+         */
+        Telemetry Snapshot() const
+        {
+            Telemetry telemetry;
+
+            telemetry.operations    = this->operations;
+            telemetry.comparisons   = this->comparisons;
+            telemetry.rotations     = this->rotations;
+            telemetry.recolors      = this->recolors;
+            telemetry.allocations   = this->allocations;
+            telemetry.deallocations = this->deallocations;
+
+            return telemetry;
+        }
+
+        /**
+         * @brief Set every counter to zero
+         */
+        void Reset()
+        {
+            *this = TelemetryCounters();
+        }
+    };
+
+    /**
+     * @brief Shape of a tree, computed on demand, and its telemetry counters
+     */
+    struct TreeStats
+    {
+        std::size_t size        = 0; // Number of nodes
+        std::size_t height      = 0; // Nodes on the longest path from the root
+        std::size_t blackHeight = 0; // Black nodes on any path from the root
+        std::size_t bytes       = 0; // Memory used by the tree object and its nodes
+
+        // depthHistogram[d] is the number of nodes at depth d (the root is at 0)
+        std::vector<std::size_t> depthHistogram;
+
+        Telemetry telemetry;
+    };
+
+    /**
+     * @brief Write the stats as one "name value" line per metric, a format that
+     * monitoring agents can scrape as is
+     */
+    inline std::ostream& operator<<(std::ostream& output, const TreeStats& stats)
+    {
+        output << "rbtree_size " << stats.size << '\n'
+               << "rbtree_height " << stats.height << '\n'
+               << "rbtree_black_height " << stats.blackHeight << '\n'
+               << "rbtree_bytes " << stats.bytes << '\n';
+
+        for (std::size_t depth = 0; depth < stats.depthHistogram.size(); depth++)
+            output << "rbtree_depth_nodes{depth=\"" << depth << "\"} "
+                   << stats.depthHistogram[depth] << '\n';
+
+        const Telemetry& telemetry = stats.telemetry;
+
+        output << "rbtree_operations " << telemetry.operations << '\n'
+               << "rbtree_comparisons " << telemetry.comparisons << '\n'
+               << "rbtree_rotations " << telemetry.rotations << '\n'
+               << "rbtree_recolors " << telemetry.recolors << '\n'
+               << "rbtree_allocations " << telemetry.allocations << '\n'
+               << "rbtree_deallocations " << telemetry.deallocations << '\n';
+
+        return output;
+    }
+} // namespace rbtree
+
+#endif // RED_BLACK_TREE_STATS_H_
@@ -0,0 +1,500 @@
+/*
+ * Filename: timing_wheel.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef TIMING_WHEEL_H_
+#define TIMING_WHEEL_H_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "vector.h"
+
+namespace utils
+{
+    /**
+     * @brief Hierarchical timing wheel for timers that are mostly cancelled before
+     * they fire, such as connection timeouts
+     *
+     * Time is counted in ticks. The wheel has LEVELS levels of 64 slots. A level 0
+     * slot covers one tick, a level 1 slot 64 ticks, a level 2 slot 64^2 ticks and
+     * so on, so the whole wheel spans 64^LEVELS ticks ahead of the current time. A
+     * timer goes into the lowest level whose range reaches its expiry. Every time
+     * the level 0 hand completes a turn, the next slot of level 1 is emptied and its
+     * timers are inserted again, now into level 0, and likewise up the levels.
+     * Timers further away than the wheel spans wait in the last slot of the top
+     * level and are placed again when it cascades
+     *
+     * Timers live in a pool and each slot is an intrusive doubly linked list, so
+     * scheduling, cancelling and rescheduling a timer are O(1). A handle carries a
+     * generation number, so a handle of a timer that already fired or was cancelled
+     * is recognized as stale even after its slot in the pool is reused
+     *
+     * Time complexities:
+     *   - Schedule, Cancel, Reschedule: O(1)
+     *   - Advance: O(levels) per tick with a slot to fire or cascade plus O(1)
+     *     per fired or cascaded timer. Ticks with nothing to do are skipped
+     *
+     * @tparam payloadT The type of the data attached to each timer
+     */
+    template<typename payloadT>
+    class TimingWheel
+    {
+        public:
+            // Pool index in the low 32 bits, generation in the high 32 bits
+            using Handle = std::uint64_t;
+
+            static constexpr std::size_t LEVELS = 6;
+
+        private:
+            static constexpr std::size_t SLOT_BITS = 6;
+            static constexpr std::size_t SLOTS     = std::size_t(1) << SLOT_BITS;
+            static constexpr std::size_t SLOT_MASK = SLOTS - 1;
+
+            // Lists past the slots: timers being fired, and free pool entries
+            static constexpr std::size_t FIRING_LIST = LEVELS * SLOTS;
+            static constexpr std::size_t FREE_LIST   = FIRING_LIST + 1;
+            static constexpr std::size_t NUM_LISTS   = FREE_LIST + 1;
+
+            static constexpr std::uint32_t NIL =
+                std::numeric_limits<std::uint32_t>::max();
+
+            struct Timer
+            {
+                std::uint64_t expiry;
+                payloadT      payload;
+                std::uint32_t prev;
+                std::uint32_t next;
+                std::uint32_t list; // The list that holds the timer
+                std::uint32_t generation;
+            };
+
+            Vector<Timer>                        m_timers;
+            std::array<std::uint32_t, NUM_LISTS> m_heads;
+            std::array<std::uint64_t, LEVELS>    m_occupied; // Bit set: slot non-empty
+            std::uint64_t                        m_now;
+            std::size_t                          m_size;
+
+            /**
+             * @brief Add a timer at the front of a list
+             */
+            void Link(std::uint32_t index, std::size_t list);
+
+            /**
+             * @brief Remove a timer from its list
+             */
+            void Unlink(std::uint32_t index);
+
+            /**
+             * @brief Put a timer in the slot that matches its expiry
+             * @param index Pool index of the timer
+             * @param earliest First tick at which the timer can still fire: the
+             * current one while its slot is being cascaded, the next one otherwise
+             */
+            void Place(std::uint32_t index, std::uint64_t earliest);
+
+            /**
+             * @brief Insert again every timer of a slot, relative to the current time
+             */
+            void Cascade(std::size_t level, std::size_t slot);
+
+            /**
+             * @brief Find the first tick, from 'tick' on, at which Advance has work:
+             * a non-empty level 0 slot to fire or a non-empty slot of a higher level
+             * to cascade. Requires a pending timer
+             */
+            std::uint64_t NextTick(std::uint64_t tick) const;
+
+            /**
+             * @brief Get the pool index of a handle
+             * @return The index, or NIL if the handle is stale
+             */
+            std::uint32_t Find(Handle handle) const;
+
+            /**
+             * @brief Move a timer to the free list, invalidating its handle
+             */
+            void Release(std::uint32_t index);
+
+        public:
+            /**
+             * @brief Constructor for TimingWheel
+             * @param now The current time, in ticks
+             */
+            TimingWheel(std::uint64_t now = 0);
+
+            ~TimingWheel();
+
+            /**
+             * @brief Schedule a timer. A timer whose expiry is not after the current
+             * time fires on the next Advance
+             * @param expiry The time at which the timer fires, in ticks
+             * @param payload The data passed to the callback of Advance
+             * @return The handle of the timer
+             */
+            Handle Schedule(std::uint64_t expiry, const payloadT& payload);
+
+            /**
+             * @brief Cancel a timer
+             * @return True if the timer was pending, False if the handle is stale
+             */
+            bool Cancel(Handle handle);
+
+            /**
+             * @brief Move a pending timer to a new expiry. The handle stays valid
+             * @return True if the timer was pending, False if the handle is stale
+             */
+            bool Reschedule(Handle handle, std::uint64_t expiry);
+
+            /**
+             * @brief Check if a timer is still pending
+             * @return True if it is, False if it fired, was cancelled or the handle
+             * is stale
+             */
+            bool Contains(Handle handle) const;
+
+            /**
+             * @brief Move the current time forward and fire every timer that expires
+             * up to it, in order of expiry tick. A timer scheduled by the callback
+             * fires no earlier than the next tick, in this call if that tick is not
+             * after 'now'
+             * @param now The new current time. Times before the current one are
+             * ignored
+             * @param fn Function called as fn(payload) for each fired timer
+             * @return The number of fired timers
+             */
+            template<typename function>
+            std::size_t Advance(std::uint64_t now, function fn);
+
+            /**
+             * @return The current time, in ticks
+             */
+            std::uint64_t Now() const;
+
+            /**
+             * @return The number of pending timers
+             */
+            std::size_t Size() const;
+
+            /**
+             * @return True if no timer is pending, False otherwise
+             */
+            bool IsEmpty() const;
+
+            /**
+             * @brief Cancel every timer. Every handle becomes stale
+             */
+            void Clear();
+    };
+
+    template<typename payloadT>
+    TimingWheel<payloadT>::TimingWheel(std::uint64_t now)
+        : m_now(now),
+          m_size(0)
+    {
+        this->m_heads.fill(NIL);
+        this->m_occupied.fill(0);
+    }
+
+    template<typename payloadT>
+    TimingWheel<payloadT>::~TimingWheel()
+    { }
+
+    template<typename payloadT>
+    typename TimingWheel<payloadT>::Handle
+    TimingWheel<payloadT>::Schedule(std::uint64_t expiry, const payloadT& payload)
+    {
+        std::uint32_t index = this->m_heads[FREE_LIST];
+
+        if (index == NIL)
+        {
+            index = static_cast<std::uint32_t>(this->m_timers.Size());
+            this->m_timers.PushBack(Timer { 0, payloadT(), NIL, NIL, FREE_LIST, 0 });
+        }
+        else
+            this->Unlink(index);
+
+        Timer& timer  = this->m_timers[index];
+        timer.expiry  = expiry;
+        timer.payload = payload;
+
+        this->Place(index, this->m_now + 1);
+        this->m_size++;
+
+        return (static_cast<Handle>(timer.generation) << 32) | index;
+    }
+
+    template<typename payloadT>
+    bool TimingWheel<payloadT>::Cancel(Handle handle)
+    {
+        std::uint32_t index = this->Find(handle);
+
+        if (index == NIL)
+            return false;
+
+        this->Unlink(index);
+        this->Release(index);
+        this->m_size--;
+
+        return true;
+    }
+
+    template<typename payloadT>
+    bool TimingWheel<payloadT>::Reschedule(Handle handle, std::uint64_t expiry)
+    {
+        std::uint32_t index = this->Find(handle);
+
+        if (index == NIL)
+            return false;
+
+        this->Unlink(index);
+        this->m_timers[index].expiry = expiry;
+        this->Place(index, this->m_now + 1);
+
+        return true;
+    }
+
+    template<typename payloadT>
+    bool TimingWheel<payloadT>::Contains(Handle handle) const
+    {
+        return this->Find(handle) != NIL;
+    }
+
+    template<typename payloadT>
+    template<typename function>
+    std::size_t TimingWheel<payloadT>::Advance(std::uint64_t now, function fn)
+    {
+        std::size_t fired = 0;
+
+        while (this->m_now < now)
+        {
+            if (this->m_size == 0)
+            {
+                this->m_now = now;
+                break;
+            }
+
+            std::uint64_t tick = this->NextTick(this->m_now + 1);
+
+            if (tick > now)
+            {
+                this->m_now = now;
+                break;
+            }
+
+            std::size_t slot = tick & SLOT_MASK;
+
+            this->m_now = tick;
+
+            // A full turn of one level moves the next slot of the level above down
+            for (std::size_t level = 1; slot == 0 and level < LEVELS; level++)
+            {
+                std::size_t upper = (tick >> (level * SLOT_BITS)) & SLOT_MASK;
+
+                this->Cascade(level, upper);
+
+                if (upper != 0)
+                    break;
+            }
+
+            // The slot moves to the firing list, so the callback can schedule or
+            // cancel timers, including the ones that are about to fire
+            std::uint32_t index;
+
+            while ((index = this->m_heads[slot]) != NIL)
+            {
+                this->Unlink(index);
+                this->Link(index, FIRING_LIST);
+            }
+
+            while ((index = this->m_heads[FIRING_LIST]) != NIL)
+            {
+                payloadT payload = std::move(this->m_timers[index].payload);
+
+                this->Unlink(index);
+                this->Release(index);
+                this->m_size--;
+
+                fn(payload);
+                fired++;
+            }
+        }
+
+        return fired;
+    }
+
+    template<typename payloadT>
+    std::uint64_t TimingWheel<payloadT>::Now() const
+    {
+        return this->m_now;
+    }
+
+    template<typename payloadT>
+    std::size_t TimingWheel<payloadT>::Size() const
+    {
+        return this->m_size;
+    }
+
+    template<typename payloadT>
+    bool TimingWheel<payloadT>::IsEmpty() const
+    {
+        return this->m_size == 0;
+    }
+
+    template<typename payloadT>
+    void TimingWheel<payloadT>::Clear()
+    {
+        for (std::size_t list = 0; list < FREE_LIST; list++)
+        {
+            std::uint32_t index;
+
+            while ((index = this->m_heads[list]) != NIL)
+            {
+                this->Unlink(index);
+                this->Release(index);
+            }
+        }
+
+        this->m_size = 0;
+    }
+
+    template<typename payloadT>
+    void TimingWheel<payloadT>::Link(std::uint32_t index, std::size_t list)
+    {
+        Timer& timer = this->m_timers[index];
+
+        timer.list = static_cast<std::uint32_t>(list);
+        timer.prev = NIL;
+        timer.next = this->m_heads[list];
+
+        if (timer.next != NIL)
+            this->m_timers[timer.next].prev = index;
+
+        this->m_heads[list] = index;
+
+        if (list < FIRING_LIST)
+            this->m_occupied[list / SLOTS] |= std::uint64_t(1) << (list % SLOTS);
+    }
+
+    template<typename payloadT>
+    void TimingWheel<payloadT>::Unlink(std::uint32_t index)
+    {
+        Timer& timer = this->m_timers[index];
+
+        if (timer.prev != NIL)
+            this->m_timers[timer.prev].next = timer.next;
+        else
+            this->m_heads[timer.list] = timer.next;
+
+        if (timer.next != NIL)
+            this->m_timers[timer.next].prev = timer.prev;
+
+        if (timer.list < FIRING_LIST and this->m_heads[timer.list] == NIL)
+            this->m_occupied[timer.list / SLOTS] &=
+                ~(std::uint64_t(1) << (timer.list % SLOTS));
+    }
+
+    template<typename payloadT>
+    void TimingWheel<payloadT>::Place(std::uint32_t index, std::uint64_t earliest)
+    {
+        // Overdue timers fire at the earliest tick
+        std::uint64_t expiry = std::max(this->m_timers[index].expiry, earliest);
+
+        std::uint64_t delta = expiry - this->m_now;
+        std::size_t   level = 0;
+
+        while (level + 1 < LEVELS and
+               delta >= (std::uint64_t(1) << ((level + 1) * SLOT_BITS)))
+            level++;
+
+        // Beyond the span of the wheel: park in the farthest slot of the top level
+        std::uint64_t span = std::uint64_t(1) << (LEVELS * SLOT_BITS);
+
+        if (delta >= span)
+            expiry = this->m_now + span - 1;
+
+        std::size_t slot = (expiry >> (level * SLOT_BITS)) & SLOT_MASK;
+
+        this->Link(index, level * SLOTS + slot);
+    }
+
+    template<typename payloadT>
+    void TimingWheel<payloadT>::Cascade(std::size_t level, std::size_t slot)
+    {
+        std::size_t   list = level * SLOTS + slot;
+        std::uint32_t index;
+
+        while ((index = this->m_heads[list]) != NIL)
+        {
+            this->Unlink(index);
+            this->Place(index, this->m_now);
+        }
+    }
+
+    template<typename payloadT>
+    std::uint64_t TimingWheel<payloadT>::NextTick(std::uint64_t tick) const
+    {
+        std::uint64_t next = std::numeric_limits<std::uint64_t>::max();
+
+        // A slot of level l is visited at the multiples of 64^l whose digit l is
+        // the slot index
+        for (std::size_t level = 0; level < LEVELS; level++)
+        {
+            std::uint64_t occupied = this->m_occupied[level];
+
+            if (occupied == 0)
+                continue;
+
+            std::size_t   shift = level * SLOT_BITS;
+            std::uint64_t turn  = ((tick - 1) >> shift) + 1; // First visit from 'tick'
+            std::size_t   slot  = turn & SLOT_MASK;
+            std::uint64_t ahead = occupied >> slot << slot;
+
+            // Without an occupied slot ahead, the first one of the next turn
+            turn += ahead != 0 ? std::countr_zero(ahead) - slot
+                               : SLOTS + std::countr_zero(occupied) - slot;
+
+            next = std::min(next, turn << shift);
+        }
+
+        return next;
+    }
+
+    template<typename payloadT>
+    std::uint32_t TimingWheel<payloadT>::Find(Handle handle) const
+    {
+        std::uint32_t index      = static_cast<std::uint32_t>(handle);
+        std::uint32_t generation = static_cast<std::uint32_t>(handle >> 32);
+
+        if (index >= this->m_timers.Size())
+            return NIL;
+
+        const Timer& timer = this->m_timers[index];
+
+        // Timers on the firing list are still pending until their callback runs
+        if (timer.generation != generation or timer.list == FREE_LIST)
+            return NIL;
+
+        return index;
+    }
+
+    template<typename payloadT>
+    void TimingWheel<payloadT>::Release(std::uint32_t index)
+    {
+        Timer& timer = this->m_timers[index];
+
+        timer.payload = payloadT();
+        timer.generation++;
+
+        this->Link(index, FREE_LIST);
+    }
+} // namespace utils
+
+#endif // TIMING_WHEEL_H_
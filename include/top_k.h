@@ -0,0 +1,374 @@
+/*
+ * Filename: top_k.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef TOP_K_H_
+#define TOP_K_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "comparators.h"
+#include "vector.h"
+
+// Binary heap namespace
+namespace bheap
+{
+    /**
+     * @brief Streaming selector that keeps the K best elements seen so far
+     *
+     * The elements are kept in a binary heap of capacity K over a Vector, with the
+     * worst kept element at the root. That element is the threshold: once the
+     * selector is full, an offered element that does not beat it is rejected with a
+     * single comparison, and one that does replaces it with one sift down. Memory
+     * stays at K elements whatever the length of the stream
+     *
+     * "Best" follows the convention of PriorityQueue: the selector keeps the K
+     * elements that a PriorityQueue with the same comparator would dequeue first.
+     * With the default comparator those are the K smallest elements, and with
+     * 'comparators::Greater<typeT>' the K largest
+     *
+     * Time complexities:
+     *   - Offer: O(1) for a rejected element, O(log K) otherwise
+     *   - Offer(span) of n elements: O(n + m log K), for m accepted elements
+     *   - Sorted: O(K log K)
+     *
+     * @tparam typeT The type of elements
+     * @tparam Compare The custom comparator that defines the best elements
+     */
+    template<typename typeT, typename Compare = decltype(comparators::Less<typeT>)>
+    class TopK
+    {
+        private:
+            // Elements checked together by the batch filter of Offer(span)
+            static constexpr std::size_t FILTER_BLOCK = 32;
+
+            Vector<typeT> m_heap;     // Root is the worst kept element
+            std::size_t   m_capacity; // K
+            Compare       m_comp;     // Custom comparator
+
+            /**
+             * @brief Move the element at 'index' up while it is worse than its
+             * parent
+             * @param index Index of the element
+             */
+            void HeapifyUp(std::size_t index);
+
+            /**
+             * @brief Move the element at 'index' down while a child is worse than it
+             * @param index Index of the element
+             */
+            void HeapifyDown(std::size_t index);
+
+        public:
+            /**
+             * @brief Constructor for TopK
+             * @param k The number of elements to keep
+             * @param comp The custom comparator to use (default is the standard
+             * comparator)
+             * @throw std::invalid_argument If k is zero
+             */
+            TopK(std::size_t k, const Compare& comp = Compare());
+
+            ~TopK();
+
+            /**
+             * @brief Offer an element to the selector
+             * @param element The element
+             * @return True if it was kept, False if it was rejected
+             */
+            bool Offer(const typeT& element);
+
+            /**
+             * @brief Offer a batch of elements. For arithmetic types, blocks of
+             * elements are first checked against the threshold by a branch-free
+             * loop that the compiler vectorizes, and blocks without a candidate
+             * never touch the heap
+             * @param elements The batch
+             */
+            void Offer(std::span<const typeT> elements);
+
+            /**
+             * @brief Offer every element kept by another selector
+             * @param other The other selector
+             */
+            void Merge(const TopK& other);
+
+            /**
+             * @brief Select the K best elements of a range with several threads.
+             * Each thread builds a selector for one slice of the range, and the
+             * selectors are then merged
+             * @param elements The range
+             * @param k The number of elements to keep
+             * @param threads The number of threads, or 0 for the number of hardware
+             * threads
+             * @param comp The custom comparator to use
+             * @return The merged selector
+             * @throw std::invalid_argument If k is zero
+             */
+            static TopK Parallel(std::span<const typeT> elements,
+                                 std::size_t            k,
+                                 std::size_t            threads = 0,
+                                 const Compare&         comp    = Compare());
+
+            /**
+             * @brief Get the worst kept element, which an offered element must beat
+             * once the selector is full
+             * @throw std::overflow_error If no element was kept
+             */
+            const typeT& Threshold() const;
+
+            /**
+             * @return The kept elements, best first
+             */
+            Vector<typeT> Sorted() const;
+
+            /**
+             * @return The number of kept elements
+             */
+            std::size_t Size() const;
+
+            /**
+             * @return K, the maximum number of kept elements
+             */
+            std::size_t Capacity() const;
+
+            /**
+             * @return True if K elements are kept, False otherwise
+             */
+            bool IsFull() const;
+
+            /**
+             * @return True if no element is kept, False otherwise
+             */
+            bool IsEmpty() const;
+
+            /**
+             * @brief Drop every kept element
+             */
+            void Clear();
+    };
+
+    template<typename typeT, typename Compare>
+    TopK<typeT, Compare>::TopK(std::size_t k, const Compare& comp)
+        : m_heap(k),
+          m_capacity(k),
+          m_comp(comp)
+    {
+        if (k == 0)
+            throw std::invalid_argument("TopK needs room for at least one element");
+    }
+
+    template<typename typeT, typename Compare>
+    TopK<typeT, Compare>::~TopK()
+    { }
+
+    template<typename typeT, typename Compare>
+    bool TopK<typeT, Compare>::Offer(const typeT& element)
+    {
+        if (this->m_heap.Size() < this->m_capacity)
+        {
+            this->m_heap.PushBack(element);
+            this->HeapifyUp(this->m_heap.Size() - 1);
+            return true;
+        }
+
+        // Fast reject: not better than the worst kept element
+        if (not this->m_comp(element, this->m_heap[0]))
+            return false;
+
+        this->m_heap[0] = element;
+        this->HeapifyDown(0);
+
+        return true;
+    }
+
+    template<typename typeT, typename Compare>
+    void TopK<typeT, Compare>::Offer(std::span<const typeT> elements)
+    {
+        std::size_t size = elements.size();
+        std::size_t i    = 0;
+
+        while (i < size and not this->IsFull())
+            this->Offer(elements[i++]);
+
+        if constexpr (std::is_arithmetic_v<typeT>)
+        {
+            for (; i + FILTER_BLOCK <= size; i += FILTER_BLOCK)
+            {
+                const typeT* block      = elements.data() + i;
+                typeT        threshold  = this->m_heap[0];
+                std::size_t  candidates = 0;
+
+                // No branch inside, so this loop becomes vector compares
+                for (std::size_t j = 0; j < FILTER_BLOCK; j++)
+                    candidates += this->m_comp(block[j], threshold);
+
+                if (candidates == 0)
+                    continue;
+
+                for (std::size_t j = 0; j < FILTER_BLOCK; j++)
+                    this->Offer(block[j]);
+            }
+        }
+
+        for (; i < size; i++)
+            this->Offer(elements[i]);
+    }
+
+    template<typename typeT, typename Compare>
+    void TopK<typeT, Compare>::Merge(const TopK& other)
+    {
+        for (std::size_t i = 0; i < other.m_heap.Size(); i++)
+            this->Offer(other.m_heap[i]);
+    }
+
+    template<typename typeT, typename Compare>
+    TopK<typeT, Compare> TopK<typeT, Compare>::Parallel(std::span<const typeT> elements,
+                                                        std::size_t            k,
+                                                        std::size_t            threads,
+                                                        const Compare&         comp)
+    {
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+
+        threads = std::max<std::size_t>(1, std::min(threads, elements.size()));
+
+        std::vector<TopK>        partial(threads, TopK(k, comp));
+        std::vector<std::thread> workers;
+        std::size_t              slice = elements.size() / threads;
+
+        for (std::size_t t = 0; t < threads; t++)
+        {
+            std::size_t first = t * slice;
+            std::size_t count = (t == threads - 1) ? elements.size() - first : slice;
+
+            workers.emplace_back([&partial, elements, t, first, count]() {
+                partial[t].Offer(elements.subspan(first, count));
+            });
+        }
+
+        for (std::thread& worker : workers)
+            worker.join();
+
+        for (std::size_t t = 1; t < threads; t++)
+            partial[0].Merge(partial[t]);
+
+        return partial[0];
+    }
+
+    template<typename typeT, typename Compare>
+    const typeT& TopK<typeT, Compare>::Threshold() const
+    {
+        if (this->m_heap.IsEmpty())
+            throw std::overflow_error("TopK is empty!");
+
+        return this->m_heap[0];
+    }
+
+    template<typename typeT, typename Compare>
+    Vector<typeT> TopK<typeT, Compare>::Sorted() const
+    {
+        // Popping the worst element of a copy fills the result from the back
+        TopK          copy(*this);
+        std::size_t   size = copy.m_heap.Size();
+        Vector<typeT> sorted(size, typeT());
+
+        for (std::size_t i = size; i > 0; i--)
+        {
+            sorted[i - 1] = copy.m_heap[0];
+
+            copy.m_heap[0] = copy.m_heap[copy.m_heap.Size() - 1];
+            copy.m_heap.PopBack();
+
+            if (not copy.m_heap.IsEmpty())
+                copy.HeapifyDown(0);
+        }
+
+        return sorted;
+    }
+
+    template<typename typeT, typename Compare>
+    std::size_t TopK<typeT, Compare>::Size() const
+    {
+        return this->m_heap.Size();
+    }
+
+    template<typename typeT, typename Compare>
+    std::size_t TopK<typeT, Compare>::Capacity() const
+    {
+        return this->m_capacity;
+    }
+
+    template<typename typeT, typename Compare>
+    bool TopK<typeT, Compare>::IsFull() const
+    {
+        return this->m_heap.Size() == this->m_capacity;
+    }
+
+    template<typename typeT, typename Compare>
+    bool TopK<typeT, Compare>::IsEmpty() const
+    {
+        return this->m_heap.IsEmpty();
+    }
+
+    template<typename typeT, typename Compare>
+    void TopK<typeT, Compare>::Clear()
+    {
+        this->m_heap.Clear();
+    }
+
+    template<typename typeT, typename Compare>
+    void TopK<typeT, Compare>::HeapifyUp(std::size_t index)
+    {
+        typeT value = std::move(this->m_heap[index]);
+
+        while (index > 0)
+        {
+            std::size_t parent = (index - 1) / 2;
+
+            if (not this->m_comp(this->m_heap[parent], value))
+                break;
+
+            this->m_heap[index] = std::move(this->m_heap[parent]);
+            index               = parent;
+        }
+
+        this->m_heap[index] = std::move(value);
+    }
+
+    template<typename typeT, typename Compare>
+    void TopK<typeT, Compare>::HeapifyDown(std::size_t index)
+    {
+        std::size_t size  = this->m_heap.Size();
+        typeT       value = std::move(this->m_heap[index]);
+
+        while (2 * index + 1 < size)
+        {
+            std::size_t child = 2 * index + 1;
+
+            // The worse child, that is, the one the other child beats
+            if (child + 1 < size and
+                this->m_comp(this->m_heap[child], this->m_heap[child + 1]))
+                child++;
+
+            if (not this->m_comp(value, this->m_heap[child]))
+                break;
+
+            this->m_heap[index] = std::move(this->m_heap[child]);
+            index               = child;
+        }
+
+        this->m_heap[index] = std::move(value);
+    }
+} // namespace bheap
+
+#endif // TOP_K_H_
@@ -0,0 +1,7 @@
+/*
+ * Filename: indexed_priority_queue.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "indexed_priority_queue.h"
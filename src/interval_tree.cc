@@ -0,0 +1,7 @@
+/*
+ * Filename: interval_tree.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "interval_tree.h"
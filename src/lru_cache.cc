@@ -0,0 +1,7 @@
+/*
+ * Filename: lru_cache.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "lru_cache.h"
@@ -0,0 +1,7 @@
+/*
+ * Filename: mapped_map.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "mapped_map.h"
@@ -0,0 +1,7 @@
+/*
+ * Filename: min_max_heap.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "min_max_heap.h"
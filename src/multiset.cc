@@ -0,0 +1,7 @@
+/*
+ * Filename: multiset.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "multiset.h"
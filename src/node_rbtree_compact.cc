@@ -0,0 +1,7 @@
+/*
+ * Filename: node_rbtree_compact.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "node_rbtree_compact.h"
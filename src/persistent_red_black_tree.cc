@@ -0,0 +1,7 @@
+/*
+ * Filename: persistent_red_black_tree.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "persistent_red_black_tree.h"
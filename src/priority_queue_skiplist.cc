@@ -0,0 +1,7 @@
+/*
+ * Filename: priority_queue_skiplist.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "priority_queue_skiplist.h"
@@ -0,0 +1,75 @@
+/*
+ * Filename: reclaimer.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "reclaimer.h"
+
+#include <utility>
+
+namespace utils
+{
+    Reclaimer::Reclaimer()
+        : m_busy(false)
+    {
+        this->m_thread = std::thread(&Reclaimer::Run, this);
+        this->m_thread.detach();
+    }
+
+    Reclaimer& Reclaimer::Instance()
+    {
+        static Reclaimer* reclaimer = new Reclaimer();
+        return *reclaimer;
+    }
+
+    void Reclaimer::Post(std::function<void()> job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            this->m_jobs.push_back(std::move(job));
+        }
+
+        this->m_wake.notify_one();
+    }
+
+    void Reclaimer::Drain()
+    {
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+
+        this->m_idle.wait(lock, [this]() {
+            return this->m_jobs.empty() and not this->m_busy;
+        });
+    }
+
+    std::size_t Reclaimer::Pending()
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        return this->m_jobs.size();
+    }
+
+    void Reclaimer::Run()
+    {
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+
+        while (true)
+        {
+            this->m_wake.wait(lock, [this]() { return not this->m_jobs.empty(); });
+
+            std::function<void()> job = std::move(this->m_jobs.front());
+            this->m_jobs.pop_front();
+            this->m_busy = true;
+
+            // The job runs without the lock, so Post never waits for it
+            lock.unlock();
+            job();
+            job = nullptr;
+            lock.lock();
+
+            this->m_busy = false;
+
+            if (this->m_jobs.empty())
+                this->m_idle.notify_all();
+        }
+    }
+} // namespace utils
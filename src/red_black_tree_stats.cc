@@ -0,0 +1,7 @@
+/*
+ * Filename: red_black_tree_stats.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "red_black_tree_stats.h"
@@ -0,0 +1,130 @@
+/*
+ * Filename: benchmark.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/**
+ * @brief Register a benchmark case. The body receives the problem size as 'size'
+ */
+#define BENCHMARK_CASE(name)                                                           \
+    static void name(std::size_t size);                                                \
+    static benchmark::Registrar name##Registrar(#name, name);                          \
+    static void name(std::size_t size)
+
+namespace benchmark
+{
+    using Function = void (*)(std::size_t size);
+
+    struct Case
+    {
+            const char* name;
+            Function    function;
+    };
+
+    /**
+     * @brief Get the list of registered benchmark cases
+     */
+    inline std::vector<Case>& Registry()
+    {
+        static std::vector<Case> cases;
+        return cases;
+    }
+
+    /**
+     * @brief Adds a case to the registry during static initialization
+     */
+    struct Registrar
+    {
+            Registrar(const char* name, Function function)
+            {
+                Registry().push_back({ name, function });
+            }
+    };
+
+    /**
+     * @brief Wall clock timer started at construction
+     */
+    class Timer
+    {
+        private:
+            std::chrono::steady_clock::time_point m_start;
+
+        public:
+            Timer()
+                : m_start(std::chrono::steady_clock::now())
+            { }
+
+            /**
+             * @return Seconds elapsed since construction
+             */
+            double Seconds() const
+            {
+                return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                                     this->m_start)
+                    .count();
+            }
+    };
+
+    /**
+     * @brief Prevent the compiler from discarding a value computed by the benchmark
+     */
+    template<typename typeT>
+    inline void DoNotOptimize(const typeT& value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /**
+     * @brief Deterministic xorshift generator, cheap enough to run inside the
+     * measured loops
+     */
+    class Random
+    {
+        private:
+            std::uint64_t m_state;
+
+        public:
+            Random(std::uint64_t seed = 0x9E3779B97F4A7C15ULL)
+                : m_state(seed)
+            { }
+
+            std::uint64_t Next()
+            {
+                this->m_state ^= this->m_state << 13;
+                this->m_state ^= this->m_state >> 7;
+                this->m_state ^= this->m_state << 17;
+                return this->m_state;
+            }
+    };
+
+    /**
+     * @brief Print one result line
+     * @param name Name of the measured operation
+     * @param size Problem size
+     * @param operations Number of operations performed
+     * @param seconds Time spent on the operations
+     */
+    inline void Report(const char* name,
+                       std::size_t size,
+                       std::size_t operations,
+                       double      seconds)
+    {
+        std::printf("%-44s n=%-12zu %10.2f ns/op %10.2f Mop/s\n",
+                    name,
+                    size,
+                    seconds * 1e9 / static_cast<double>(operations),
+                    static_cast<double>(operations) / seconds / 1e6);
+    }
+} // namespace benchmark
+
+#endif // BENCHMARK_H_
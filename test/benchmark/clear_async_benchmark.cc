@@ -0,0 +1,54 @@
+/*
+ * Filename: clear_async_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <cstdio>
+
+#include "benchmark.h"
+#include "map.h"
+#include "reclaimer.h"
+
+// Time the calling thread is blocked when dropping a large map with Clear, with
+// ClearAsync, and with the longest step of ClearSome
+BENCHMARK_CASE(ClearAsync)
+{
+    using Key = std::uint64_t;
+
+    benchmark::Random     random;
+    rbtree::Map<Key, Key> map;
+
+    auto fill = [&]() {
+        for (std::size_t i = 0; i < size; i++)
+            map.Insert(random.Next(), i);
+    };
+
+    fill();
+    benchmark::Timer clearTimer;
+    map.Clear();
+    double clearSeconds = clearTimer.Seconds();
+
+    fill();
+    benchmark::Timer asyncTimer;
+    map.ClearAsync();
+    double asyncSeconds = asyncTimer.Seconds();
+
+    utils::Reclaimer::Instance().Drain();
+
+    fill();
+    double longestStep = 0;
+
+    for (bool done = false; not done;)
+    {
+        benchmark::Timer stepTimer;
+        done        = map.ClearSome(10000);
+        double step = stepTimer.Seconds();
+        longestStep = step > longestStep ? step : longestStep;
+    }
+
+    benchmark::Report("Map::Clear", size, 1, clearSeconds);
+    benchmark::Report("Map::ClearAsync", size, 1, asyncSeconds);
+    benchmark::Report("Map::ClearSome(10000), longest", size, 1, longestStep);
+}
@@ -0,0 +1,70 @@
+/*
+ * Filename: compact_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <cstdio>
+
+#include "benchmark.h"
+#include "map.h"
+
+// Ordered iteration over a map fragmented by churn, before and after Compact, and
+// the longest pause of an incremental compaction
+BENCHMARK_CASE(Compact)
+{
+    using Key = std::uint64_t;
+
+    benchmark::Random     random;
+    rbtree::Map<Key, Key> map;
+
+    // Random insertions and removals scatter the nodes across the heap
+    for (std::size_t i = 0; i < 2 * size; i++)
+    {
+        Key key = random.Next() % (2 * size);
+
+        if (i % 3 == 2)
+            map.Remove(key);
+        else
+            map.Insert(key, i);
+    }
+
+    auto iterate = [&map]() -> double {
+        Key              sum = 0;
+        benchmark::Timer timer;
+
+        for (auto& pair : map)
+            sum += pair.GetSecond();
+
+        benchmark::DoNotOptimize(sum);
+        return timer.Seconds();
+    };
+
+    double scatteredSeconds = iterate();
+
+    std::size_t      steps    = 0;
+    double           maxPause = 0;
+    benchmark::Timer compactTimer;
+
+    for (bool done = false; not done; steps++)
+    {
+        benchmark::Timer stepTimer;
+        done         = map.CompactStep(4096);
+        double pause = stepTimer.Seconds();
+        maxPause     = pause > maxPause ? pause : maxPause;
+    }
+
+    double compactSeconds   = compactTimer.Seconds();
+    double compactedSeconds = iterate();
+
+    std::size_t n = map.Size();
+
+    benchmark::Report("Iterate, scattered nodes", n, n, scatteredSeconds);
+    benchmark::Report("Iterate, compacted nodes", n, n, compactedSeconds);
+    benchmark::Report("CompactStep(4096)", n, n, compactSeconds);
+    std::printf("Iteration speedup: %.2fx, %zu steps, longest step %.3f ms\n",
+                scatteredSeconds / compactedSeconds,
+                steps,
+                maxPause * 1e3);
+}
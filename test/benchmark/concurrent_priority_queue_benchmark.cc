@@ -0,0 +1,82 @@
+/*
+ * Filename: concurrent_priority_queue_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "benchmark.h"
+#include "concurrent_priority_queue.h"
+#include "priority_queue_bheap.h"
+
+namespace
+{
+    // Split 'operations' Dequeue + Enqueue pairs among 'threads' threads
+    template<typename function>
+    double RunThreads(std::size_t threads, std::size_t operations, function work)
+    {
+        std::vector<std::thread> workers;
+
+        benchmark::Timer timer;
+
+        for (std::size_t t = 0; t < threads; t++)
+            workers.emplace_back([&, t]() {
+                benchmark::Random random(t + 1);
+
+                for (std::size_t i = t; i < operations; i += threads)
+                    work(random);
+            });
+
+        for (std::thread& worker : workers)
+            worker.join();
+
+        return timer.Seconds();
+    }
+} // namespace
+
+// A hold model shared by 1 to 64 threads: each operation removes an element and
+// inserts a new one. The relaxed queue is compared against a PriorityQueue behind
+// a mutex, which is what the threads would share otherwise
+BENCHMARK_CASE(ConcurrentPriorityQueue)
+{
+    for (std::size_t threads = 1; threads <= 64; threads *= 2)
+    {
+        bheap::ConcurrentPriorityQueue<std::uint64_t> relaxed(threads);
+        bheap::PriorityQueue<std::uint64_t>           locked;
+        std::mutex                                    mutex;
+        benchmark::Random                             random;
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            std::uint64_t key = random.Next() >> 8;
+            relaxed.Enqueue(key);
+            locked.Enqueue(key);
+        }
+
+        double relaxedSeconds = RunThreads(threads, size, [&](benchmark::Random& r) {
+            std::uint64_t key = 0;
+            relaxed.TryDequeue(key);
+            relaxed.Enqueue(key + r.Next() % 1024);
+        });
+
+        double lockedSeconds = RunThreads(threads, size, [&](benchmark::Random& r) {
+            std::lock_guard<std::mutex> lock(mutex);
+            locked.Enqueue(locked.Dequeue() + r.Next() % 1024);
+        });
+
+        char name[64];
+
+        std::snprintf(name, sizeof(name), "ConcurrentPriorityQueue, %zu threads",
+                      threads);
+        benchmark::Report(name, size, size, relaxedSeconds);
+
+        std::snprintf(name, sizeof(name), "PriorityQueue + mutex, %zu threads",
+                      threads);
+        benchmark::Report(name, size, size, lockedSeconds);
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * Filename: dary_heap_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "binary_heap.h"
+#include "dary_heap.h"
+
+// Push every key and then pop them all. The push phase stresses the climb, which
+// gets shorter as the arity grows, and the pop phase stresses the descent, which
+// compares more children per level
+template<typename heapT>
+static void RunHeap(const std::string& name, const std::vector<std::uint64_t>& keys)
+{
+    heapT         heap;
+    std::uint64_t sum = 0;
+
+    benchmark::Timer pushTimer;
+    for (std::uint64_t key : keys)
+        heap.Push(key);
+    double pushSeconds = pushTimer.Seconds();
+
+    benchmark::Timer popTimer;
+    while (not heap.IsEmpty())
+        sum += heap.Pop();
+    double popSeconds = popTimer.Seconds();
+
+    benchmark::DoNotOptimize(sum);
+
+    benchmark::Report((name + "::Push").c_str(), keys.size(), keys.size(), pushSeconds);
+    benchmark::Report((name + "::Pop").c_str(), keys.size(), keys.size(), popSeconds);
+}
+
+// Mixed workloads on a heap that stays large. Push-heavy pops once every four
+// operations while the heap grows, like an event queue that is filled faster than
+// it drains. Pop-heavy starts from a full heap and pushes once every four
+// operations, like a scheduler draining its backlog
+template<typename heapT>
+static void RunMixed(const std::string& name, const std::vector<std::uint64_t>& keys)
+{
+    std::size_t   operations = keys.size();
+    std::uint64_t sum        = 0;
+
+    {
+        heapT heap;
+
+        benchmark::Timer timer;
+        for (std::size_t i = 0; i < operations; i++)
+        {
+            if (i % 4 == 3)
+                sum += heap.Pop();
+            else
+                heap.Push(keys[i]);
+        }
+        double seconds = timer.Seconds();
+
+        benchmark::Report((name + "::PushHeavy").c_str(),
+                          keys.size(),
+                          operations,
+                          seconds);
+    }
+
+    {
+        heapT heap;
+
+        for (std::uint64_t key : keys)
+            heap.Push(key);
+
+        benchmark::Timer timer;
+        for (std::size_t i = 0; i < operations; i++)
+        {
+            if (i % 4 == 0)
+                heap.Push(keys[i]);
+            else
+                sum += heap.Pop();
+        }
+        double seconds = timer.Seconds();
+
+        benchmark::Report((name + "::PopHeavy").c_str(),
+                          keys.size(),
+                          operations,
+                          seconds);
+    }
+
+    benchmark::DoNotOptimize(sum);
+}
+
+BENCHMARK_CASE(DaryHeap)
+{
+    benchmark::Random          random;
+    std::vector<std::uint64_t> keys;
+
+    for (std::size_t i = 0; i < size; i++)
+        keys.push_back(random.Next());
+
+    RunHeap<bheap::BinaryHeap<std::uint64_t>>("BinaryHeap", keys);
+    RunHeap<bheap::DaryHeap<std::uint64_t, 2>>("DaryHeap<2>", keys);
+    RunHeap<bheap::DaryHeap<std::uint64_t, 4>>("DaryHeap<4>", keys);
+    RunHeap<bheap::DaryHeap<std::uint64_t, 8>>("DaryHeap<8>", keys);
+    RunHeap<bheap::DaryHeap<std::uint64_t, 16>>("DaryHeap<16>", keys);
+
+    RunMixed<bheap::BinaryHeap<std::uint64_t>>("BinaryHeap", keys);
+    RunMixed<bheap::DaryHeap<std::uint64_t, 2>>("DaryHeap<2>", keys);
+    RunMixed<bheap::DaryHeap<std::uint64_t, 4>>("DaryHeap<4>", keys);
+    RunMixed<bheap::DaryHeap<std::uint64_t, 8>>("DaryHeap<8>", keys);
+    RunMixed<bheap::DaryHeap<std::uint64_t, 16>>("DaryHeap<16>", keys);
+}
@@ -0,0 +1,47 @@
+/*
+ * Filename: frozen_map_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <cstdio>
+
+#include "benchmark.h"
+#include "frozen_map.h"
+#include "map.h"
+
+// Lookups of random present keys, comparing the pointer-based tree with its frozen
+// Eytzinger copy
+BENCHMARK_CASE(FrozenMapLookup)
+{
+    rbtree::Map<std::uint64_t, std::uint64_t> map;
+    benchmark::Random                         random;
+
+    // Keys are multiples of a large odd constant, so they are distinct and spread
+    for (std::size_t i = 0; i < size; i++)
+        map.Insert(i * 0x9E3779B97F4A7C15ULL, i);
+
+    benchmark::Timer                                 freezeTimer;
+    rbtree::FrozenMap<std::uint64_t, std::uint64_t> frozen = map.Freeze();
+    benchmark::Report("FrozenMap::Freeze", size, size, freezeTimer.Seconds());
+
+    std::size_t   lookups = size < 10000000 ? 10000000 : size;
+    std::uint64_t sum     = 0;
+
+    benchmark::Timer treeTimer;
+    for (std::size_t i = 0; i < lookups; i++)
+        sum += map.Get((random.Next() % size) * 0x9E3779B97F4A7C15ULL);
+    double treeSeconds = treeTimer.Seconds();
+
+    benchmark::Timer frozenTimer;
+    for (std::size_t i = 0; i < lookups; i++)
+        sum += frozen.Get((random.Next() % size) * 0x9E3779B97F4A7C15ULL);
+    double frozenSeconds = frozenTimer.Seconds();
+
+    benchmark::DoNotOptimize(sum);
+
+    benchmark::Report("Map::Get", size, lookups, treeSeconds);
+    benchmark::Report("FrozenMap::Get", size, lookups, frozenSeconds);
+    std::printf("FrozenMap speedup: %.2fx\n", treeSeconds / frozenSeconds);
+}
@@ -0,0 +1,61 @@
+/*
+ * Filename: heap_build_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark.h"
+#include "priority_queue_bheap.h"
+
+// Rebuild a priority queue from a batch of keys with one Enqueue per key and with
+// the range constructor, then refresh the top with Dequeue + Enqueue against
+// ReplaceTop
+BENCHMARK_CASE(HeapBuild)
+{
+    benchmark::Random          random;
+    std::vector<std::uint64_t> keys;
+
+    for (std::size_t i = 0; i < size; i++)
+        keys.push_back(random.Next());
+
+    bheap::PriorityQueue<std::uint64_t> enqueued;
+
+    benchmark::Timer enqueueTimer;
+    for (std::uint64_t key : keys)
+        enqueued.Enqueue(key);
+    double enqueueSeconds = enqueueTimer.Seconds();
+
+    benchmark::Timer buildTimer;
+    bheap::PriorityQueue<std::uint64_t> built(keys.begin(), keys.end());
+    double buildSeconds = buildTimer.Seconds();
+
+    std::size_t   refreshes = size;
+    std::uint64_t sum       = 0;
+
+    benchmark::Timer twoSiftTimer;
+    for (std::size_t i = 0; i < refreshes; i++)
+    {
+        std::uint64_t top = enqueued.Dequeue();
+        sum += top;
+        enqueued.Enqueue(top + random.Next() % 1024);
+    }
+    double twoSiftSeconds = twoSiftTimer.Seconds();
+
+    benchmark::Timer replaceTimer;
+    for (std::size_t i = 0; i < refreshes; i++)
+    {
+        std::uint64_t top = built.Peek();
+        sum += built.ReplaceTop(top + random.Next() % 1024);
+    }
+    double replaceSeconds = replaceTimer.Seconds();
+
+    benchmark::DoNotOptimize(sum);
+
+    benchmark::Report("PriorityQueue::Enqueue (n calls)", size, size, enqueueSeconds);
+    benchmark::Report("PriorityQueue(first, last)", size, size, buildSeconds);
+    benchmark::Report("Dequeue + Enqueue", size, refreshes, twoSiftSeconds);
+    benchmark::Report("ReplaceTop", size, refreshes, replaceSeconds);
+}
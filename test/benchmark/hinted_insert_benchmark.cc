@@ -0,0 +1,53 @@
+/*
+ * Filename: hinted_insert_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "benchmark.h"
+#include "red_black_tree.h"
+
+// Ingest of nearly sorted keys, such as timestamps that arrive slightly out of
+// order: plain Insert against Append and Insert with the previous node as hint
+BENCHMARK_CASE(HintedInsert)
+{
+    benchmark::Random          random;
+    std::vector<std::uint64_t> keys;
+
+    // Every key is displaced by at most 8 positions from its sorted position
+    for (std::size_t i = 0; i < size; i++)
+        keys.push_back(i * 16 + random.Next() % 128);
+
+    rbtree::RedBlackTree<std::uint64_t> plain;
+    rbtree::RedBlackTree<std::uint64_t> appended;
+    rbtree::RedBlackTree<std::uint64_t> hinted;
+
+    benchmark::Timer insertTimer;
+    for (std::uint64_t key : keys)
+        plain.Insert(key);
+    double insertSeconds = insertTimer.Seconds();
+
+    benchmark::Timer appendTimer;
+    for (std::uint64_t key : keys)
+        appended.Append(key);
+    double appendSeconds = appendTimer.Seconds();
+
+    benchmark::Timer             hintTimer;
+    rbtree::Node<std::uint64_t>* hint = nullptr;
+    for (std::uint64_t key : keys)
+        hint = hinted.Insert(hint, key);
+    double hintSeconds = hintTimer.Seconds();
+
+    benchmark::DoNotOptimize(plain.Size() + appended.Size() + hinted.Size());
+
+    benchmark::Report("RedBlackTree::Insert", size, size, insertSeconds);
+    benchmark::Report("RedBlackTree::Append", size, size, appendSeconds);
+    benchmark::Report("RedBlackTree::Insert(hint)", size, size, hintSeconds);
+    std::printf("Speedup over Insert: append %.2fx, hint %.2fx\n",
+                insertSeconds / appendSeconds,
+                insertSeconds / hintSeconds);
+}
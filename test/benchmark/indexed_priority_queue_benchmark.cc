@@ -0,0 +1,133 @@
+/*
+ * Filename: indexed_priority_queue_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "benchmark.h"
+#include "indexed_priority_queue.h"
+#include "priority_queue_bheap.h"
+
+namespace
+{
+    struct Edge
+    {
+        std::uint32_t to;
+        std::uint64_t weight;
+    };
+
+    using Graph = std::vector<std::vector<Edge>>;
+
+    constexpr std::uint64_t INFINITE = std::numeric_limits<std::uint64_t>::max();
+
+    // Dijkstra that pushes a new entry on every relaxation and skips the stale
+    // entries when they are dequeued
+    std::uint64_t LazyDijkstra(const Graph& graph, std::size_t& peak)
+    {
+        using Entry = std::pair<std::uint64_t, std::uint32_t>;
+
+        std::vector<std::uint64_t>  dist(graph.size(), INFINITE);
+        bheap::PriorityQueue<Entry> pqueue;
+
+        dist[0] = 0;
+        pqueue.Enqueue(Entry(0, 0));
+
+        while (not pqueue.IsEmpty())
+        {
+            peak          = std::max(peak, pqueue.Size());
+            Entry current = pqueue.Dequeue();
+
+            if (current.first != dist[current.second])
+                continue;
+
+            for (const Edge& edge : graph[current.second])
+                if (current.first + edge.weight < dist[edge.to])
+                {
+                    dist[edge.to] = current.first + edge.weight;
+                    pqueue.Enqueue(Entry(dist[edge.to], edge.to));
+                }
+        }
+
+        return dist.back();
+    }
+
+    // Dijkstra that keeps one entry per vertex and lowers it with DecreaseKey
+    std::uint64_t IndexedDijkstra(const Graph& graph, std::size_t& peak)
+    {
+        using Entry  = std::pair<std::uint64_t, std::uint32_t>;
+        using Handle = bheap::IndexedPriorityQueue<Entry>::Handle;
+
+        constexpr Handle NONE = std::numeric_limits<Handle>::max();
+
+        std::vector<std::uint64_t>         dist(graph.size(), INFINITE);
+        std::vector<Handle>                handles(graph.size(), NONE);
+        bheap::IndexedPriorityQueue<Entry> pqueue;
+
+        dist[0]    = 0;
+        handles[0] = pqueue.Push(Entry(0, 0));
+
+        while (not pqueue.IsEmpty())
+        {
+            peak          = std::max(peak, pqueue.Size());
+            Entry current = pqueue.Dequeue();
+
+            handles[current.second] = NONE;
+
+            for (const Edge& edge : graph[current.second])
+                if (current.first + edge.weight < dist[edge.to])
+                {
+                    dist[edge.to] = current.first + edge.weight;
+
+                    if (handles[edge.to] == NONE)
+                        handles[edge.to] = pqueue.Push(Entry(dist[edge.to], edge.to));
+                    else
+                        pqueue.DecreaseKey(handles[edge.to],
+                                           Entry(dist[edge.to], edge.to));
+                }
+        }
+
+        return dist.back();
+    }
+} // namespace
+
+// Shortest paths on a random graph with 'size' vertices and eight edges per vertex
+BENCHMARK_CASE(IndexedPriorityQueue)
+{
+    benchmark::Random random;
+    Graph             graph(size);
+
+    for (std::size_t v = 0; v < size; v++)
+        for (int e = 0; e < 8; e++)
+            graph[v].push_back(
+                Edge { static_cast<std::uint32_t>(random.Next() % size),
+                       random.Next() % 1000 + 1 });
+
+    std::size_t lazyPeak    = 0;
+    std::size_t indexedPeak = 0;
+
+    benchmark::Timer lazyTimer;
+    std::uint64_t    lazy        = LazyDijkstra(graph, lazyPeak);
+    double           lazySeconds = lazyTimer.Seconds();
+
+    benchmark::Timer indexedTimer;
+    std::uint64_t    indexed        = IndexedDijkstra(graph, indexedPeak);
+    double           indexedSeconds = indexedTimer.Seconds();
+
+    benchmark::DoNotOptimize(lazy);
+    benchmark::DoNotOptimize(indexed);
+
+    benchmark::Report("Dijkstra, lazy deletion", size, size, lazySeconds);
+    benchmark::Report("Dijkstra, DecreaseKey", size, size, indexedSeconds);
+
+    std::printf("  peak queue size: lazy %zu, indexed %zu, same result: %s\n",
+                lazyPeak,
+                indexedPeak,
+                lazy == indexed ? "yes" : "no");
+}
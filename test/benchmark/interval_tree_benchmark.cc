@@ -0,0 +1,73 @@
+/*
+ * Filename: interval_tree_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark.h"
+#include "interval_tree.h"
+
+// Stabbing queries over short intervals, answered by the interval tree and by a
+// linear scan, plus the O(n) build against one insertion per interval
+BENCHMARK_CASE(IntervalTree)
+{
+    using IntervalT = rbtree::Interval<std::uint64_t, std::uint64_t>;
+
+    benchmark::Random      random;
+    std::vector<IntervalT> intervals;
+    std::uint64_t          range = size * 16;
+
+    for (std::size_t i = 0; i < size; i++)
+    {
+        std::uint64_t low = random.Next() % range;
+        intervals.emplace_back(low, low + random.Next() % 64, i);
+    }
+
+    rbtree::IntervalTree<std::uint64_t, std::uint64_t> inserted;
+
+    benchmark::Timer insertTimer;
+    for (const IntervalT& interval : intervals)
+        inserted.Insert(interval.low, interval.high, interval.value);
+    double insertSeconds = insertTimer.Seconds();
+
+    std::sort(intervals.begin(),
+              intervals.end(),
+              rbtree::IntervalLess<std::uint64_t, std::uint64_t>);
+
+    rbtree::IntervalTree<std::uint64_t, std::uint64_t> built;
+
+    benchmark::Timer buildTimer;
+    built.Build(intervals);
+    double buildSeconds = buildTimer.Seconds();
+
+    std::size_t queries = 1000;
+    std::size_t found   = 0;
+
+    benchmark::Timer treeTimer;
+    for (std::size_t i = 0; i < queries; i++)
+        built.Stabbing(random.Next() % range,
+                       [&](std::uint64_t, std::uint64_t, std::uint64_t) { found++; });
+    double treeSeconds = treeTimer.Seconds();
+
+    benchmark::Timer scanTimer;
+    for (std::size_t i = 0; i < queries; i++)
+    {
+        std::uint64_t point = random.Next() % range;
+
+        for (const IntervalT& interval : intervals)
+            if (interval.low <= point and point <= interval.high)
+                found++;
+    }
+    double scanSeconds = scanTimer.Seconds();
+
+    benchmark::DoNotOptimize(found);
+
+    benchmark::Report("IntervalTree::Insert", size, size, insertSeconds);
+    benchmark::Report("IntervalTree::Build", size, size, buildSeconds);
+    benchmark::Report("IntervalTree::Stabbing", size, queries, treeSeconds);
+    benchmark::Report("Linear scan", size, queries, scanSeconds);
+}
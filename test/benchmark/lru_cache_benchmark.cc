@@ -0,0 +1,47 @@
+/*
+ * Filename: lru_cache_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <cstdio>
+
+#include "benchmark.h"
+#include "lru_cache.h"
+
+// Read-through cache over a key space 4x larger than the cache. Half of the
+// accesses go to a hot set of 1/8 of the key space, which stays cached, so about
+// half of the accesses hit and almost every miss costs an eviction
+BENCHMARK_CASE(LruCacheGetPut)
+{
+    lru::LruCache<std::uint64_t, std::uint64_t> cache(size);
+    benchmark::Random                           random;
+
+    std::uint64_t keys       = 4 * size;
+    std::size_t   operations = 10 * size;
+    std::uint64_t sum        = 0;
+
+    benchmark::Timer timer;
+    for (std::size_t i = 0; i < operations; i++)
+    {
+        std::uint64_t r   = random.Next();
+        std::uint64_t key = (r & 1) ? (r >> 1) % (keys / 8 + 1) : (r >> 1) % keys;
+
+        std::uint64_t* value = cache.Get(key);
+
+        if (value != nullptr)
+            sum += *value;
+        else
+            cache.Put(key, key);
+    }
+    double seconds = timer.Seconds();
+
+    benchmark::DoNotOptimize(sum);
+
+    benchmark::Report("LruCache::Get/Put", size, operations, seconds);
+    std::printf("LruCache hits: %zu misses: %zu evictions: %zu\n",
+                cache.Hits(),
+                cache.Misses(),
+                cache.Evictions());
+}
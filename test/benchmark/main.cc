@@ -0,0 +1,33 @@
+/*
+ * Filename: main.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+#include "benchmark.h"
+
+#define BENCHMARK_DEFAULT_SIZE 1000000
+
+/**
+ * Usage: benchmark [size] [filter]
+ *
+ * Runs every registered case whose name contains 'filter' with the given problem
+ * size (default 1M)
+ */
+int main(int argc, char* argv[])
+{
+    std::size_t size   = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                  : BENCHMARK_DEFAULT_SIZE;
+    const char* filter = argc > 2 ? argv[2] : "";
+
+    for (const benchmark::Case& c : benchmark::Registry())
+    {
+        if (std::strstr(c.name, filter) != nullptr)
+            c.function(size);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,67 @@
+/*
+ * Filename: map_batch_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "benchmark.h"
+#include "map.h"
+
+// Random keys inserted and looked up one call at a time against the batch APIs
+BENCHMARK_CASE(MapBatch)
+{
+    benchmark::Random                               random;
+    std::vector<Pair<std::uint64_t, std::uint64_t>> pairs;
+    std::vector<std::uint64_t>                      queries;
+
+    for (std::size_t i = 0; i < size; i++)
+    {
+        std::uint64_t key = random.Next();
+        pairs.push_back(Pair<std::uint64_t, std::uint64_t>(key, i));
+
+        // Half of the queries hit
+        queries.push_back(i % 2 == 0 ? key : random.Next());
+    }
+
+    rbtree::Map<std::uint64_t, std::uint64_t> single;
+    rbtree::Map<std::uint64_t, std::uint64_t> batch;
+
+    benchmark::Timer insertTimer;
+    for (Pair<std::uint64_t, std::uint64_t>& pair : pairs)
+        single.Insert(pair.GetFirst(), pair.GetSecond());
+    double insertSeconds = insertTimer.Seconds();
+
+    benchmark::Timer insertBatchTimer;
+    batch.InsertBatch(pairs);
+    double insertBatchSeconds = insertBatchTimer.Seconds();
+
+    std::unique_ptr<bool[]> found(new bool[size]);
+    std::size_t             hits = 0;
+
+    benchmark::Timer containsTimer;
+    for (std::size_t i = 0; i < size; i++)
+        hits += single.Contains(queries[i]);
+    double containsSeconds = containsTimer.Seconds();
+
+    benchmark::Timer containsBatchTimer;
+    batch.ContainsBatch(queries, std::span<bool>(found.get(), size));
+    double containsBatchSeconds = containsBatchTimer.Seconds();
+
+    for (std::size_t i = 0; i < size; i++)
+        hits += found[i];
+
+    benchmark::DoNotOptimize(hits);
+
+    benchmark::Report("Map::Insert", size, size, insertSeconds);
+    benchmark::Report("Map::InsertBatch", size, size, insertBatchSeconds);
+    benchmark::Report("Map::Contains", size, size, containsSeconds);
+    benchmark::Report("Map::ContainsBatch", size, size, containsBatchSeconds);
+    std::printf("Batch speedup: insert %.2fx, contains %.2fx\n",
+                insertSeconds / insertBatchSeconds,
+                containsSeconds / containsBatchSeconds);
+}
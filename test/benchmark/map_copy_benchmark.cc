@@ -0,0 +1,46 @@
+/*
+ * Filename: map_copy_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+
+#include "benchmark.h"
+#include "map.h"
+
+// Copying a map by reinserting its elements, against the structural copy
+// constructor and the move constructor
+BENCHMARK_CASE(MapCopy)
+{
+    using Key = std::uint64_t;
+
+    benchmark::Random     random;
+    rbtree::Map<Key, Key> map;
+
+    for (std::size_t i = 0; i < size; i++)
+        map.Insert(random.Next(), i);
+
+    benchmark::Timer      rebuildTimer;
+    rbtree::Map<Key, Key> rebuilt;
+    for (auto& pair : map)
+        rebuilt.Insert(pair.GetFirst(), pair.GetSecond());
+    double rebuildSeconds = rebuildTimer.Seconds();
+
+    benchmark::Timer      copyTimer;
+    rbtree::Map<Key, Key> copy(map);
+    double                copySeconds = copyTimer.Seconds();
+
+    benchmark::Timer      moveTimer;
+    rbtree::Map<Key, Key> moved(std::move(copy));
+    double                moveSeconds = moveTimer.Seconds();
+
+    benchmark::DoNotOptimize(rebuilt.Size() + moved.Size());
+
+    benchmark::Report("Rebuild by Insert", size, size, rebuildSeconds);
+    benchmark::Report("Map copy constructor", size, size, copySeconds);
+    benchmark::Report("Map move constructor", size, 1, moveSeconds);
+    std::printf("Copy speedup over rebuild: %.2fx\n", rebuildSeconds / copySeconds);
+}
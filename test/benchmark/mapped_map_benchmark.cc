@@ -0,0 +1,52 @@
+/*
+ * Filename: mapped_map_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+#include "benchmark.h"
+#include "map.h"
+#include "mapped_map.h"
+
+// Startup cost of restoring a map: inserting every key again against mapping an
+// exported snapshot. Followed by random lookups on the mapped file
+BENCHMARK_CASE(MappedMapStartup)
+{
+    std::string path =
+        (std::filesystem::temp_directory_path() / "mapped_map_benchmark.snapshot")
+            .string();
+
+    {
+        rbtree::Map<std::uint64_t, std::uint64_t> map;
+
+        benchmark::Timer insertTimer;
+        for (std::size_t i = 0; i < size; i++)
+            map.Insert(i, i);
+        benchmark::Report("Map::Insert (restore)", size, size, insertTimer.Seconds());
+
+        benchmark::Timer exportTimer;
+        map.Export(path);
+        benchmark::Report("Map::Export", size, size, exportTimer.Seconds());
+    }
+
+    benchmark::Timer                                 openTimer;
+    rbtree::MappedMap<std::uint64_t, std::uint64_t> mapped(path);
+    benchmark::Report("MappedMap open", size, 1, openTimer.Seconds());
+
+    benchmark::Random random;
+    std::size_t       lookups = 1000000;
+    std::uint64_t     sum     = 0;
+
+    benchmark::Timer lookupTimer;
+    for (std::size_t i = 0; i < lookups; i++)
+        sum += mapped.Get(random.Next() % size);
+    benchmark::Report("MappedMap::Get", size, lookups, lookupTimer.Seconds());
+
+    benchmark::DoNotOptimize(sum);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,124 @@
+/*
+ * Filename: min_max_heap_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "benchmark.h"
+#include "binary_heap.h"
+#include "min_max_heap.h"
+
+namespace
+{
+    // Requests held by the admission pool
+    constexpr std::size_t POOL = 4096;
+
+    using Entry = std::pair<std::uint64_t, std::uint32_t>; // (priority, id)
+
+    // A pool bounded by two heaps, one per end. An element removed through one
+    // heap is flagged dead and skipped when it reaches the top of the other
+    class TwoHeapPool
+    {
+        private:
+            bheap::BinaryHeap<Entry, decltype(comparators::Less<Entry>)>    m_low;
+            bheap::BinaryHeap<Entry, decltype(comparators::Greater<Entry>)> m_high;
+            std::vector<bool>                                               m_dead;
+            std::size_t                                                     m_size = 0;
+
+            template<typename heapT>
+            Entry PopLive(heapT& heap)
+            {
+                while (this->m_dead[heap.Peek().second])
+                    heap.Pop();
+
+                Entry entry                = heap.Pop();
+                this->m_dead[entry.second] = true;
+                this->m_size--;
+
+                return entry;
+            }
+
+        public:
+            TwoHeapPool(std::size_t ids)
+                : m_dead(ids, false)
+            { }
+
+            void Push(const Entry& entry)
+            {
+                this->m_low.Push(entry);
+                this->m_high.Push(entry);
+                this->m_size++;
+            }
+
+            Entry PopLowest()
+            {
+                return this->PopLive(this->m_low);
+            }
+
+            Entry PopHighest()
+            {
+                return this->PopLive(this->m_high);
+            }
+
+            std::size_t Size() const
+            {
+                return this->m_size;
+            }
+    };
+} // namespace
+
+// Admission control: 'size' requests arrive with random priorities into a pool of
+// POOL requests. When the pool is full the lowest priority one is evicted, and every
+// other arrival the highest priority one is served
+BENCHMARK_CASE(MinMaxHeap)
+{
+    benchmark::Random          random;
+    std::vector<std::uint64_t> priorities(size);
+
+    for (std::uint64_t& priority : priorities)
+        priority = random.Next() % 1000000;
+
+    std::uint64_t sum = 0;
+
+    benchmark::Timer twoHeapTimer;
+    TwoHeapPool      twoHeaps(size);
+
+    for (std::size_t i = 0; i < size; i++)
+    {
+        twoHeaps.Push(Entry(priorities[i], static_cast<std::uint32_t>(i)));
+
+        if (twoHeaps.Size() > POOL)
+            sum += twoHeaps.PopLowest().first;
+
+        if (i % 2 == 1)
+            sum += twoHeaps.PopHighest().first;
+    }
+
+    double twoHeapSeconds = twoHeapTimer.Seconds();
+
+    // Ordered by priority, highest first, so that the max end is the lowest one
+    benchmark::Timer minMaxTimer;
+    bheap::MinMaxHeap<Entry, decltype(comparators::Greater<Entry>)> pool(POOL);
+
+    for (std::size_t i = 0; i < size; i++)
+    {
+        Entry evicted;
+
+        if (pool.Push(Entry(priorities[i], static_cast<std::uint32_t>(i)), evicted))
+            sum += evicted.first;
+
+        if (i % 2 == 1)
+            sum += pool.PopMin().first;
+    }
+
+    double minMaxSeconds = minMaxTimer.Seconds();
+
+    benchmark::DoNotOptimize(sum);
+
+    benchmark::Report("Admission, two BinaryHeaps", size, size, twoHeapSeconds);
+    benchmark::Report("Admission, MinMaxHeap", size, size, minMaxSeconds);
+}
@@ -0,0 +1,66 @@
+/*
+ * Filename: multiset_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <cstdio>
+
+#include "benchmark.h"
+#include "map.h"
+#include "multiset.h"
+#include "red_black_tree.h"
+#include "vector.h"
+
+// Duplicate-heavy keys (100 copies of each key on average) stored with the
+// vector-per-key workaround, with InsertMulti and with the counted MultiSet
+BENCHMARK_CASE(MultiSet)
+{
+    using Key = std::uint64_t;
+
+    benchmark::Random random;
+    std::size_t       distinct = size / 100 + 1;
+
+    rbtree::Map<Key, Vector<Key>> workaround;
+    rbtree::RedBlackTree<Key>     siblings;
+    rbtree::MultiSet<Key>         counted;
+
+    benchmark::Timer workaroundTimer;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        Key key = random.Next() % distinct;
+        workaround[key].PushBack(key);
+    }
+    double workaroundSeconds = workaroundTimer.Seconds();
+
+    benchmark::Timer siblingsTimer;
+    for (std::size_t i = 0; i < size; i++)
+        siblings.InsertMulti(random.Next() % distinct);
+    double siblingsSeconds = siblingsTimer.Seconds();
+
+    benchmark::Timer countedTimer;
+    for (std::size_t i = 0; i < size; i++)
+        counted.Insert(random.Next() % distinct);
+    double countedSeconds = countedTimer.Seconds();
+
+    // Node memory plus the buffers owned by the vectors
+    std::size_t workaroundBytes =
+        workaround.Size() * sizeof(rbtree::Node<Pair<Key, Vector<Key>>>);
+
+    for (auto& pair : workaround)
+        workaroundBytes += pair.GetSecond().GetMaxSize() * sizeof(Key);
+
+    std::size_t siblingsBytes = siblings.Size() * sizeof(rbtree::Node<Key>);
+    std::size_t countedBytes =
+        counted.DistinctSize() * sizeof(rbtree::Node<Pair<Key, std::size_t>>);
+
+    benchmark::Report("Map<K, Vector<K>>", size, size, workaroundSeconds);
+    benchmark::Report("RedBlackTree::InsertMulti", size, size, siblingsSeconds);
+    benchmark::Report("MultiSet::Insert", size, size, countedSeconds);
+    std::printf("Memory: vector per key %zu KiB, InsertMulti %zu KiB, "
+                "MultiSet %zu KiB\n",
+                workaroundBytes / 1024,
+                siblingsBytes / 1024,
+                countedBytes / 1024);
+}
@@ -0,0 +1,130 @@
+/*
+ * Filename: pairing_heap_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "benchmark.h"
+#include "binary_heap.h"
+#include "indexed_priority_queue.h"
+#include "pairing_heap.h"
+
+// Push then pop every key, meld per-worker heaps into one, and lower random keys
+// before draining the heap. BinaryHeap melds by popping and pushing every element,
+// and the decrease-key mix runs against the binary IndexedPriorityQueue
+BENCHMARK_CASE(PairingHeap)
+{
+    benchmark::Random          random;
+    std::vector<std::uint64_t> keys;
+    std::uint64_t              sum = 0;
+
+    for (std::size_t i = 0; i < size; i++)
+        keys.push_back(random.Next() >> 1);
+
+    {
+        bheap::PairingHeap<std::uint64_t> pairing;
+        bheap::BinaryHeap<std::uint64_t>  binary;
+
+        benchmark::Timer pairingTimer;
+        for (std::uint64_t key : keys)
+            pairing.Push(key);
+        while (not pairing.IsEmpty())
+            sum += pairing.Pop();
+        double pairingSeconds = pairingTimer.Seconds();
+
+        benchmark::Timer binaryTimer;
+        for (std::uint64_t key : keys)
+            binary.Push(key);
+        while (not binary.IsEmpty())
+            sum += binary.Pop();
+        double binarySeconds = binaryTimer.Seconds();
+
+        benchmark::Report("PairingHeap Push + Pop", size, size, pairingSeconds);
+        benchmark::Report("BinaryHeap Push + Pop", size, size, binarySeconds);
+    }
+
+    {
+        constexpr std::size_t WORKERS = 64;
+
+        std::vector<std::unique_ptr<bheap::PairingHeap<std::uint64_t>>> pairings;
+        std::vector<std::unique_ptr<bheap::BinaryHeap<std::uint64_t>>>  binaries;
+
+        for (std::size_t w = 0; w < WORKERS; w++)
+        {
+            pairings.push_back(std::make_unique<bheap::PairingHeap<std::uint64_t>>());
+            binaries.push_back(std::make_unique<bheap::BinaryHeap<std::uint64_t>>());
+        }
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            pairings[i % WORKERS]->Push(keys[i]);
+            binaries[i % WORKERS]->Push(keys[i]);
+        }
+
+        benchmark::Timer pairingTimer;
+        for (std::size_t w = 1; w < WORKERS; w++)
+            pairings[0]->Meld(*pairings[w]);
+        double pairingSeconds = pairingTimer.Seconds();
+
+        benchmark::Timer binaryTimer;
+        for (std::size_t w = 1; w < WORKERS; w++)
+            while (not binaries[w]->IsEmpty())
+                binaries[0]->Push(binaries[w]->Pop());
+        double binarySeconds = binaryTimer.Seconds();
+
+        sum += pairings[0]->Peek() + binaries[0]->Peek();
+
+        benchmark::Report("PairingHeap Meld (64 heaps)", size, size, pairingSeconds);
+        benchmark::Report("BinaryHeap re-push (64 heaps)", size, size, binarySeconds);
+    }
+
+    {
+        using PairingHandle = bheap::PairingHeap<std::uint64_t>::Handle;
+        using IndexedHandle = bheap::IndexedPriorityQueue<std::uint64_t>::Handle;
+
+        bheap::PairingHeap<std::uint64_t>          pairing;
+        bheap::IndexedPriorityQueue<std::uint64_t> indexed;
+        std::vector<PairingHandle>                 pairingHandles;
+        std::vector<IndexedHandle>                 indexedHandles;
+        std::vector<std::size_t>                   targets;
+
+        for (std::size_t i = 0; i < size; i++)
+            targets.push_back(random.Next() % size);
+
+        benchmark::Timer pairingTimer;
+        for (std::uint64_t key : keys)
+            pairingHandles.push_back(pairing.Push(key));
+        for (std::size_t target : targets)
+        {
+            PairingHandle handle = pairingHandles[target];
+            pairing.DecreaseKey(handle, pairing.Get(handle) / 2);
+        }
+        while (not pairing.IsEmpty())
+            sum += pairing.Pop();
+        double pairingSeconds = pairingTimer.Seconds();
+
+        benchmark::Timer indexedTimer;
+        for (std::uint64_t key : keys)
+            indexedHandles.push_back(indexed.Push(key));
+        for (std::size_t target : targets)
+        {
+            IndexedHandle handle = indexedHandles[target];
+            indexed.DecreaseKey(handle, indexed.Get(handle) / 2);
+        }
+        while (not indexed.IsEmpty())
+            sum += indexed.Dequeue();
+        double indexedSeconds = indexedTimer.Seconds();
+
+        benchmark::Report("PairingHeap DecreaseKey mix", size, size, pairingSeconds);
+        benchmark::Report("IndexedPriorityQueue DecreaseKey mix",
+                          size,
+                          size,
+                          indexedSeconds);
+    }
+
+    benchmark::DoNotOptimize(sum);
+}
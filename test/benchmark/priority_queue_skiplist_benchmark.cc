@@ -0,0 +1,72 @@
+/*
+ * Filename: priority_queue_skiplist_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark.h"
+#include "priority_queue_bheap.h"
+#include "priority_queue_skiplist.h"
+#include "priority_queue_slkd.h"
+
+namespace
+{
+    // The sorted list inserts in O(n), so it only runs up to this size
+    constexpr std::size_t SLKD_LIMIT = 20000;
+
+    // Fill the queue with 'count' keys, then alternate a Dequeue with an Enqueue
+    // of a later key, as in an event queue held at a steady depth
+    template<typename queueT>
+    double Hold(queueT&                           pqueue,
+                const std::vector<std::uint64_t>& keys,
+                std::size_t                       count)
+    {
+        benchmark::Timer timer;
+        std::uint64_t    sum = 0;
+
+        for (std::size_t i = 0; i < count; i++)
+            pqueue.Enqueue(keys[i]);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            std::uint64_t key = pqueue.Dequeue();
+            sum += key;
+            pqueue.Enqueue(key + keys[i]);
+        }
+
+        double seconds = timer.Seconds();
+
+        benchmark::DoNotOptimize(sum);
+
+        return seconds;
+    }
+} // namespace
+
+// A queue of 'size' random keys under the hold model. The sorted list stops at
+// SLKD_LIMIT keys
+BENCHMARK_CASE(SkipListPriorityQueue)
+{
+    benchmark::Random          random;
+    std::vector<std::uint64_t> keys(size);
+
+    for (std::uint64_t& key : keys)
+        key = random.Next() % 1000000;
+
+    std::size_t                        slkdSize = std::min(size, SLKD_LIMIT);
+    slkd::PriorityQueue<std::uint64_t> slkdQueue;
+    double                             slkdSeconds = Hold(slkdQueue, keys, slkdSize);
+
+    skiplist::PriorityQueue<std::uint64_t> skipQueue;
+    double                                 skipSeconds = Hold(skipQueue, keys, size);
+
+    bheap::PriorityQueue<std::uint64_t> heapQueue;
+    double                              heapSeconds = Hold(heapQueue, keys, size);
+
+    benchmark::Report("Hold, slkd::PriorityQueue", slkdSize, 2 * slkdSize, slkdSeconds);
+    benchmark::Report("Hold, skiplist::PriorityQueue", size, 2 * size, skipSeconds);
+    benchmark::Report("Hold, bheap::PriorityQueue", size, 2 * size, heapSeconds);
+}
@@ -0,0 +1,155 @@
+/*
+ * Filename: radix_heap_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "benchmark.h"
+#include "priority_queue_bheap.h"
+#include "radix_heap.h"
+
+namespace
+{
+    struct Arc
+    {
+        std::uint32_t to;
+        std::uint64_t weight;
+    };
+
+    using Graph = std::vector<std::vector<Arc>>;
+
+    constexpr std::uint64_t UNREACHED = std::numeric_limits<std::uint64_t>::max();
+
+    // Dijkstra with lazy deletion over a PriorityQueue of (distance, vertex) pairs
+    std::uint64_t HeapDijkstra(const Graph& graph)
+    {
+        using Entry = std::pair<std::uint64_t, std::uint32_t>;
+
+        std::vector<std::uint64_t>  dist(graph.size(), UNREACHED);
+        bheap::PriorityQueue<Entry> pqueue;
+
+        dist[0] = 0;
+        pqueue.Enqueue(Entry(0, 0));
+
+        while (not pqueue.IsEmpty())
+        {
+            Entry current = pqueue.Dequeue();
+
+            if (current.first != dist[current.second])
+                continue;
+
+            for (const Arc& arc : graph[current.second])
+                if (current.first + arc.weight < dist[arc.to])
+                {
+                    dist[arc.to] = current.first + arc.weight;
+                    pqueue.Enqueue(Entry(dist[arc.to], arc.to));
+                }
+        }
+
+        return dist.back();
+    }
+
+    // The same search over a RadixHeap keyed by distance
+    std::uint64_t RadixDijkstra(const Graph& graph)
+    {
+        std::vector<std::uint64_t>                     dist(graph.size(), UNREACHED);
+        bheap::RadixHeap<std::uint64_t, std::uint32_t> pqueue;
+
+        dist[0] = 0;
+        pqueue.Push(0, 0);
+
+        while (not pqueue.IsEmpty())
+        {
+            Pair<std::uint64_t, std::uint32_t> current = pqueue.Dequeue();
+
+            std::uint64_t distance = current.GetFirst();
+            std::uint32_t vertex   = current.GetSecond();
+
+            if (distance != dist[vertex])
+                continue;
+
+            for (const Arc& arc : graph[vertex])
+                if (distance + arc.weight < dist[arc.to])
+                {
+                    dist[arc.to] = distance + arc.weight;
+                    pqueue.Push(dist[arc.to], arc.to);
+                }
+        }
+
+        return dist.back();
+    }
+} // namespace
+
+// Shortest paths on a random graph with 'size' vertices and eight arcs per vertex,
+// then a hold model: 'size' events pending, each step fires the earliest one and
+// schedules a new one a random delay later
+BENCHMARK_CASE(RadixHeap)
+{
+    benchmark::Random random;
+    Graph             graph(size);
+
+    for (std::size_t v = 0; v < size; v++)
+        for (int e = 0; e < 8; e++)
+            graph[v].push_back(Arc { static_cast<std::uint32_t>(random.Next() % size),
+                                     random.Next() % 1000 + 1 });
+
+    benchmark::Timer heapTimer;
+    std::uint64_t    heapResult  = HeapDijkstra(graph);
+    double           heapSeconds = heapTimer.Seconds();
+
+    benchmark::Timer radixTimer;
+    std::uint64_t    radixResult  = RadixDijkstra(graph);
+    double           radixSeconds = radixTimer.Seconds();
+
+    benchmark::DoNotOptimize(heapResult);
+    benchmark::DoNotOptimize(radixResult);
+
+    benchmark::Report("Dijkstra, PriorityQueue", size, size, heapSeconds);
+    benchmark::Report("Dijkstra, RadixHeap", size, size, radixSeconds);
+
+    using Event = std::pair<std::uint64_t, std::uint64_t>;
+
+    bheap::PriorityQueue<Event>                    events;
+    bheap::RadixHeap<std::uint64_t, std::uint64_t> radixEvents;
+    std::uint64_t                                  sum = 0;
+
+    for (std::size_t i = 0; i < size; i++)
+    {
+        std::uint64_t time = random.Next() % 1000000;
+        events.Enqueue(Event(time, i));
+        radixEvents.Push(time, i);
+    }
+
+    std::vector<std::uint64_t> delays;
+
+    for (std::size_t i = 0; i < size; i++)
+        delays.push_back(random.Next() % 1000000);
+
+    benchmark::Timer holdHeapTimer;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        Event event = events.Dequeue();
+        sum += event.second;
+        events.Enqueue(Event(event.first + delays[i], event.second));
+    }
+    double holdHeapSeconds = holdHeapTimer.Seconds();
+
+    benchmark::Timer holdRadixTimer;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        Pair<std::uint64_t, std::uint64_t> event = radixEvents.Dequeue();
+        sum += event.GetSecond();
+        radixEvents.Push(event.GetFirst() + delays[i], event.GetSecond());
+    }
+    double holdRadixSeconds = holdRadixTimer.Seconds();
+
+    benchmark::DoNotOptimize(sum);
+
+    benchmark::Report("Hold model, PriorityQueue", size, size, holdHeapSeconds);
+    benchmark::Report("Hold model, RadixHeap", size, size, holdRadixSeconds);
+}
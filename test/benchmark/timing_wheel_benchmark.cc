@@ -0,0 +1,97 @@
+/*
+ * Filename: timing_wheel_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "benchmark.h"
+#include "indexed_priority_queue.h"
+#include "priority_queue_bheap.h"
+#include "timing_wheel.h"
+
+namespace
+{
+    // Ticks until a connection times out
+    constexpr std::uint64_t TIMEOUT = 30000;
+
+    // Ticks a connection stays open before it finishes and cancels its timer
+    constexpr std::size_t LIFETIME = 10000;
+
+    // One connection in FIRE_RATE never finishes and its timer fires
+    constexpr std::size_t FIRE_RATE = 100;
+
+    using Entry        = std::pair<std::uint64_t, std::uint64_t>;
+    using IndexedQueue = bheap::IndexedPriorityQueue<Entry>;
+    using Wheel        = utils::TimingWheel<std::uint64_t>;
+} // namespace
+
+// Connection timeouts: one connection opens per tick and schedules its timeout, and
+// almost all of them finish after LIFETIME ticks and cancel it, so that the clock
+// runs for 'size' ticks and only one timer in FIRE_RATE fires
+BENCHMARK_CASE(TimingWheel)
+{
+    std::uint64_t fired = 0;
+
+    // Lazy cancellation: a cancelled entry is flagged and skipped when it expires,
+    // so the heap also holds the cancelled timers of the last TIMEOUT ticks
+    benchmark::Timer            lazyTimer;
+    bheap::PriorityQueue<Entry> lazy;
+    std::vector<bool>           cancelled(size, false);
+
+    for (std::uint64_t now = 0; now < size; now++)
+    {
+        lazy.Enqueue(Entry(now + TIMEOUT, now));
+
+        if (now >= LIFETIME and (now - LIFETIME) % FIRE_RATE != 0)
+            cancelled[now - LIFETIME] = true;
+
+        while (not lazy.IsEmpty() and lazy.Peek().first <= now)
+            fired += not cancelled[lazy.Dequeue().second];
+    }
+
+    double lazySeconds = lazyTimer.Seconds();
+
+    // Eager cancellation: the entry is removed from the heap through its handle
+    benchmark::Timer                  indexedTimer;
+    IndexedQueue                      indexed;
+    std::vector<IndexedQueue::Handle> indexedHandles(size);
+
+    for (std::uint64_t now = 0; now < size; now++)
+    {
+        indexedHandles[now] = indexed.Push(Entry(now + TIMEOUT, now));
+
+        if (now >= LIFETIME and (now - LIFETIME) % FIRE_RATE != 0)
+            indexed.Remove(indexedHandles[now - LIFETIME]);
+
+        while (not indexed.IsEmpty() and indexed.Peek().first <= now)
+            fired += indexed.Dequeue().second;
+    }
+
+    double indexedSeconds = indexedTimer.Seconds();
+
+    benchmark::Timer           wheelTimer;
+    Wheel                      wheel;
+    std::vector<Wheel::Handle> wheelHandles(size);
+
+    for (std::uint64_t now = 0; now < size; now++)
+    {
+        wheelHandles[now] = wheel.Schedule(now + TIMEOUT, now);
+
+        if (now >= LIFETIME and (now - LIFETIME) % FIRE_RATE != 0)
+            wheel.Cancel(wheelHandles[now - LIFETIME]);
+
+        wheel.Advance(now, [&fired](std::uint64_t& id) { fired += id; });
+    }
+
+    double wheelSeconds = wheelTimer.Seconds();
+
+    benchmark::DoNotOptimize(fired);
+
+    benchmark::Report("Timeouts, PriorityQueue (lazy cancel)", size, size, lazySeconds);
+    benchmark::Report("Timeouts, IndexedPriorityQueue", size, size, indexedSeconds);
+    benchmark::Report("Timeouts, TimingWheel", size, size, wheelSeconds);
+}
@@ -0,0 +1,75 @@
+/*
+ * Filename: top_k_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark.h"
+#include "priority_queue_bheap.h"
+#include "top_k.h"
+
+// The 100 largest of 'size' random scores: a PriorityQueue holding the whole
+// stream, TopK fed one score at a time, the batch filter and the parallel mode
+BENCHMARK_CASE(TopK)
+{
+    using Greater = decltype(comparators::Greater<float>);
+
+    constexpr std::size_t K = 100;
+
+    benchmark::Random  random;
+    std::vector<float> scores;
+
+    for (std::size_t i = 0; i < size; i++)
+        scores.push_back(static_cast<float>(random.Next() % 1000000007) / 7.0f);
+
+    float sum = 0;
+
+    benchmark::Timer queueTimer;
+    {
+        bheap::PriorityQueue<float, Greater> pqueue;
+
+        for (float score : scores)
+            pqueue.Enqueue(score);
+
+        for (std::size_t i = 0; i < K; i++)
+            sum += pqueue.Dequeue();
+    }
+    double queueSeconds = queueTimer.Seconds();
+
+    benchmark::Timer singleTimer;
+    {
+        bheap::TopK<float, Greater> top(K);
+
+        for (float score : scores)
+            top.Offer(score);
+
+        sum += top.Threshold();
+    }
+    double singleSeconds = singleTimer.Seconds();
+
+    benchmark::Timer batchTimer;
+    {
+        bheap::TopK<float, Greater> top(K);
+        top.Offer(scores);
+        sum += top.Threshold();
+    }
+    double batchSeconds = batchTimer.Seconds();
+
+    benchmark::Timer parallelTimer;
+    {
+        bheap::TopK<float, Greater> top =
+            bheap::TopK<float, Greater>::Parallel(scores, K);
+        sum += top.Threshold();
+    }
+    double parallelSeconds = parallelTimer.Seconds();
+
+    benchmark::DoNotOptimize(sum);
+
+    benchmark::Report("PriorityQueue, whole stream", size, size, queueSeconds);
+    benchmark::Report("TopK::Offer(element)", size, size, singleSeconds);
+    benchmark::Report("TopK::Offer(span)", size, size, batchSeconds);
+    benchmark::Report("TopK::Parallel", size, size, parallelSeconds);
+}
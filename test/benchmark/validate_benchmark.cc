@@ -0,0 +1,49 @@
+/*
+ * Filename: validate_benchmark.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <cstdio>
+
+#include "benchmark.h"
+#include "red_black_tree.h"
+
+// Cost of the full validation, of one sampled path, and of leaving the sampled
+// validation on during an ingest
+BENCHMARK_CASE(Validate)
+{
+    benchmark::Random                   random;
+    rbtree::RedBlackTree<std::uint64_t> plain;
+    rbtree::RedBlackTree<std::uint64_t> sampled;
+
+    sampled.SetValidationInterval(64);
+
+    benchmark::Timer insertTimer;
+    for (std::size_t i = 0; i < size; i++)
+        plain.Insert(random.Next());
+    double insertSeconds = insertTimer.Seconds();
+
+    benchmark::Timer sampledTimer;
+    for (std::size_t i = 0; i < size; i++)
+        sampled.Insert(random.Next());
+    double sampledSeconds = sampledTimer.Seconds();
+
+    benchmark::Timer validateTimer;
+    plain.Validate();
+    double validateSeconds = validateTimer.Seconds();
+
+    std::size_t      samples = 100000;
+    benchmark::Timer sampleTimer;
+    for (std::size_t i = 0; i < samples; i++)
+        plain.ValidateSample();
+    double sampleSeconds = sampleTimer.Seconds();
+
+    benchmark::Report("RedBlackTree::Insert", size, size, insertSeconds);
+    benchmark::Report("Insert, sampled every 64", size, size, sampledSeconds);
+    benchmark::Report("RedBlackTree::Validate", size, size, validateSeconds);
+    benchmark::Report("RedBlackTree::ValidateSample", size, samples, sampleSeconds);
+    std::printf("Sampled validation overhead: %.1f%%\n",
+                100.0 * (sampledSeconds - insertSeconds) / insertSeconds);
+}
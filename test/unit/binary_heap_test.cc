@@ -6,6 +6,11 @@
 
 #include "doctest.h"
 
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
 #include "binary_heap.h"
 
 TEST_CASE("Max binary heap: Inserir/Remover elemento")
@@ -79,3 +84,77 @@ TEST_CASE("Min binary heap: Inserir/Remover elemento")
         CHECK(bheap.IsEmpty());
     }
 }
+
+TEST_CASE("Binary heap: Construção a partir de um intervalo, PushRange, ReplaceTop e "
+          "PushPop")
+{
+    std::vector<int> values;
+    std::mt19937     generator(42);
+
+    for (int i = 0; i < 1000; i++)
+        values.push_back(static_cast<int>(generator() % 500));
+
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    SUBCASE("Construção em O(n)")
+    {
+        bheap::BinaryHeap<int> bheap(values.begin(), values.end());
+
+        CHECK(bheap.Size() == values.size());
+
+        for (int value : sorted)
+            CHECK(bheap.Pop() == value);
+
+        CHECK(bheap.IsEmpty());
+    }
+
+    SUBCASE("PushRange grande e pequeno")
+    {
+        bheap::BinaryHeap<int> bheap;
+
+        // The first range rebuilds the heap, the second is sifted element by element
+        bheap.PushRange(values.begin(), values.begin() + 900);
+        bheap.PushRange(values.begin() + 900, values.end());
+
+        for (int value : sorted)
+            CHECK(bheap.Pop() == value);
+    }
+
+    SUBCASE("ReplaceTop")
+    {
+        bheap::BinaryHeap<int, decltype(comparators::Greater<int>)> bheap;
+
+        CHECK_THROWS_AS(bheap.ReplaceTop(1), std::underflow_error);
+
+        for (int value : { 5, 1, 8, 3 })
+            bheap.Push(value);
+
+        CHECK(bheap.ReplaceTop(2) == 8);
+        CHECK(bheap.Size() == 4);
+        CHECK(bheap.Pop() == 5);
+        CHECK(bheap.Pop() == 3);
+        CHECK(bheap.Pop() == 2);
+        CHECK(bheap.Pop() == 1);
+    }
+
+    SUBCASE("PushPop")
+    {
+        bheap::BinaryHeap<int> bheap;
+
+        CHECK(bheap.PushPop(7) == 7);
+        CHECK(bheap.IsEmpty());
+
+        for (int value : { 5, 1, 8, 3 })
+            bheap.Push(value);
+
+        CHECK(bheap.PushPop(0) == 0);
+        CHECK(bheap.PushPop(1) == 1);
+        CHECK(bheap.PushPop(4) == 1);
+        CHECK(bheap.Size() == 4);
+        CHECK(bheap.Pop() == 3);
+        CHECK(bheap.Pop() == 4);
+        CHECK(bheap.Pop() == 5);
+        CHECK(bheap.Pop() == 8);
+    }
+}
@@ -0,0 +1,141 @@
+/*
+ * Filename: concurrent_priority_queue_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "concurrent_priority_queue.h"
+
+TEST_CASE("Concurrent Priority Queue: Modo estrito")
+{
+    bheap::ConcurrentPriorityQueue<int, decltype(comparators::Greater<int>)> pqueue(
+        8,
+        2,
+        true);
+
+    CHECK(pqueue.NumHeaps() == 1);
+    CHECK_THROWS_AS(pqueue.Peek(), std::overflow_error);
+    CHECK_THROWS_AS(pqueue.Dequeue(), std::underflow_error);
+
+    for (int value : { 2, 4, 1, 6, 3, 3, 10, 0 })
+        pqueue.Enqueue(value);
+
+    CHECK(pqueue.Size() == 8);
+    CHECK(pqueue.Peek() == 10);
+
+    for (int value : { 10, 6, 4, 3, 3, 2, 1, 0 })
+        CHECK(pqueue.Dequeue() == value);
+
+    int element;
+    CHECK_FALSE(pqueue.TryDequeue(element));
+    CHECK(pqueue.IsEmpty());
+
+    CHECK_THROWS_AS(bheap::ConcurrentPriorityQueue<int>(4, 0), std::invalid_argument);
+}
+
+TEST_CASE("Concurrent Priority Queue: Modo relaxado com uma thread")
+{
+    bheap::ConcurrentPriorityQueue<int> pqueue(4, 2);
+
+    std::vector<int> values;
+    std::mt19937     generator(1);
+
+    CHECK(pqueue.NumHeaps() == 8);
+
+    for (int i = 0; i < 5000; i++)
+        values.push_back(i);
+
+    std::shuffle(values.begin(), values.end(), generator);
+
+    for (int value : values)
+        pqueue.Enqueue(value);
+
+    CHECK(pqueue.Peek() == 0);
+
+    // Every element comes back once, and each one is close to the best remaining
+    std::vector<bool> seen(values.size(), false);
+    std::size_t       worstRank = 0;
+    int               smallest  = 0;
+
+    while (not pqueue.IsEmpty())
+    {
+        int value = pqueue.Dequeue();
+
+        CHECK_FALSE(seen[value]);
+        seen[value] = true;
+
+        while (smallest < static_cast<int>(seen.size()) and seen[smallest])
+            smallest++;
+
+        // Elements still queued that are better than the one returned
+        std::size_t rank = 0;
+
+        if (value > smallest)
+            rank = std::count(seen.begin() + smallest, seen.begin() + value, false);
+
+        worstRank = std::max(worstRank, rank);
+    }
+
+    CHECK(std::all_of(seen.begin(), seen.end(), [](bool s) { return s; }));
+    CHECK(worstRank < 200);
+
+    pqueue.Enqueue(1);
+    pqueue.Clear();
+    CHECK(pqueue.Size() == 0);
+}
+
+TEST_CASE("Concurrent Priority Queue: Várias threads")
+{
+    constexpr int THREADS    = 8;
+    constexpr int PER_THREAD = 5000;
+
+    bheap::ConcurrentPriorityQueue<int> pqueue(THREADS);
+
+    std::vector<std::thread>      workers;
+    std::vector<std::atomic<int>> counts(THREADS * PER_THREAD);
+    std::atomic<int>              popped = 0;
+
+    for (int t = 0; t < THREADS; t++)
+        workers.emplace_back([&, t]() {
+            for (int i = 0; i < PER_THREAD; i++)
+            {
+                pqueue.Enqueue(t * PER_THREAD + i);
+
+                int element;
+
+                // Pops interleaved with the pushes of the other threads
+                if (i % 2 == 1 and pqueue.TryDequeue(element))
+                {
+                    counts[element]++;
+                    popped++;
+                }
+            }
+        });
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    int element;
+
+    while (pqueue.TryDequeue(element))
+    {
+        counts[element]++;
+        popped++;
+    }
+
+    CHECK(popped == THREADS * PER_THREAD);
+    CHECK(pqueue.IsEmpty());
+    CHECK(std::all_of(counts.begin(), counts.end(), [](std::atomic<int>& c) {
+        return c == 1;
+    }));
+}
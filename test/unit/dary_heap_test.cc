@@ -0,0 +1,100 @@
+/*
+ * Filename: dary_heap_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "dary_heap.h"
+
+template<std::size_t D>
+static void CheckSortedOrder(std::size_t size)
+{
+    bheap::DaryHeap<int, D> heap;
+    std::vector<int>        values;
+    std::mt19937            generator(static_cast<unsigned>(size * D));
+
+    for (std::size_t i = 0; i < size; i++)
+    {
+        int value = static_cast<int>(generator() % 1000);
+        values.push_back(value);
+        heap.Push(value);
+    }
+
+    std::sort(values.begin(), values.end());
+
+    CHECK(heap.Size() == size);
+
+    for (int value : values)
+    {
+        CHECK(heap.Peek() == value);
+        CHECK(heap.Pop() == value);
+    }
+
+    CHECK(heap.IsEmpty());
+}
+
+TEST_CASE("D-ary heap: Ordem de remoção para várias aridades")
+{
+    for (std::size_t size : { 1, 2, 5, 17, 1000 })
+    {
+        CheckSortedOrder<2>(size);
+        CheckSortedOrder<3>(size);
+        CheckSortedOrder<4>(size);
+        CheckSortedOrder<8>(size);
+    }
+}
+
+TEST_CASE("D-ary heap: Max heap, elementos não triviais e heap vazio")
+{
+    SUBCASE("Max heap")
+    {
+        bheap::DaryHeap<int, 4, decltype(comparators::Greater<int>)> heap;
+
+        for (int value : { 2, 4, 1, 6, 3, 3, 10, 0 })
+            heap.Push(value);
+
+        for (int value : { 10, 6, 4, 3, 3, 2, 1, 0 })
+            CHECK(heap.Pop() == value);
+
+        CHECK(heap.IsEmpty());
+    }
+
+    SUBCASE("Strings")
+    {
+        bheap::DaryHeap<std::string, 3> heap;
+
+        for (const char* value : { "pera", "uva", "banana", "abacaxi", "maçã" })
+            heap.Push(value);
+
+        CHECK(heap.Pop() == "abacaxi");
+        CHECK(heap.Pop() == "banana");
+        CHECK(heap.Pop() == "maçã");
+        CHECK(heap.Pop() == "pera");
+        CHECK(heap.Pop() == "uva");
+    }
+
+    SUBCASE("Heap vazio")
+    {
+        bheap::DaryHeap<int> heap;
+
+        CHECK_THROWS_AS(heap.Peek(), std::overflow_error);
+        CHECK_THROWS_AS(heap.Pop(), std::underflow_error);
+
+        heap.Push(1);
+        heap.Push(2);
+        heap.Clear();
+
+        CHECK(heap.IsEmpty());
+        CHECK(heap.Size() == 0);
+        CHECK_THROWS_AS(heap.Pop(), std::underflow_error);
+    }
+}
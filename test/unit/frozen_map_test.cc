@@ -0,0 +1,196 @@
+/*
+ * Filename: frozen_map_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "doctest.h"
+
+#include "frozen_map.h"
+#include "map.h"
+#include "red_black_tree.h"
+
+TEST_CASE("Congelamento de um map")
+{
+    rbtree::Map<uint32_t, std::string> map;
+
+    for (uint32_t i = 0; i < 1000; i++)
+        map.Insert(i * 3, std::to_string(i));
+
+    rbtree::FrozenMap<uint32_t, std::string> frozen = map.Freeze();
+
+    CHECK(frozen.Size() == 1000);
+    CHECK(map.Size() == 1000);
+
+    SUBCASE("Busca de chaves presentes e ausentes")
+    {
+        for (uint32_t i = 0; i < 3000; i++)
+        {
+            CHECK(frozen.Contains(i) == (i % 3 == 0));
+
+            if (i % 3 == 0)
+                CHECK(frozen.Get(i) == std::to_string(i / 3));
+            else
+                CHECK(frozen.Search(i) == nullptr);
+        }
+
+        CHECK_THROWS_AS(frozen.Get(1), std::out_of_range);
+        CHECK_FALSE(frozen.Contains(3000));
+    }
+
+    SUBCASE("Percorre as chaves em ordem")
+    {
+        uint32_t expected = 0;
+
+        frozen.ForEach([&expected](const uint32_t& key, const std::string& value) {
+            CHECK(key == expected * 3);
+            CHECK(value == std::to_string(expected));
+            expected++;
+        });
+
+        CHECK(expected == 1000);
+    }
+
+    SUBCASE("Move")
+    {
+        rbtree::FrozenMap<uint32_t, std::string> other = std::move(frozen);
+
+        CHECK(other.Size() == 1000);
+        CHECK(other.Get(42) == "14");
+        CHECK(frozen.IsEmpty());
+        CHECK_FALSE(frozen.Contains(42));
+    }
+}
+
+TEST_CASE("Congelamento de uma árvore")
+{
+    rbtree::RedBlackTree<int> tree;
+
+    rbtree::FrozenSet<int> empty = tree.Freeze();
+    CHECK(empty.IsEmpty());
+    CHECK_FALSE(empty.Contains(0));
+
+    // Sizes that fill the last level of the implicit tree and sizes that do not
+    for (int size : {1, 2, 3, 7, 8, 100})
+    {
+        tree.Clear();
+
+        for (int i = 0; i < size; i++)
+            tree.Insert(size - i);
+
+        rbtree::FrozenSet<int> frozen = tree.Freeze();
+
+        CHECK(frozen.Size() == static_cast<std::size_t>(size));
+
+        for (int i = 0; i <= size + 1; i++)
+            CHECK(frozen.Contains(i) == (i >= 1 and i <= size));
+
+        int expected = 1;
+        frozen.ForEach([&expected](const int& key) { CHECK(key == expected++); });
+        CHECK(expected == size + 1);
+    }
+}
+
+TEST_CASE("Construção a partir de chaves fora de ordem")
+{
+    int keys[] = { 1, 3, 2 };
+    int next   = 0;
+
+    CHECK_THROWS_AS(rbtree::FrozenSet<int>(3, [&]() { return keys[next++]; }),
+                    std::invalid_argument);
+}
+
+// Comparator whose order is chosen at runtime
+struct RuntimeOrder
+{
+    bool descending = false;
+
+    bool operator()(int a, int b) const
+    {
+        return this->descending ? a > b : a < b;
+    }
+};
+
+TEST_CASE("Movimentação com comparadores com estado")
+{
+    using Set = rbtree::FrozenSet<int, RuntimeOrder>;
+
+    int next = 100;
+    Set set(10, [&]() { return next -= 10; }, RuntimeOrder { true });
+    Set other(RuntimeOrder { false });
+
+    // The keys only make sense with the order they were built with
+    other = std::move(set);
+
+    for (int key = 0; key < 100; key += 10)
+        CHECK(other.Contains(key));
+
+    CHECK_FALSE(other.Contains(5));
+}
+
+// Key that counts its live instances
+struct CountedKey
+{
+    int value = 0;
+
+    static inline int live = 0;
+
+    CountedKey()
+    {
+        live++;
+    }
+
+    CountedKey(int value)
+        : value(value)
+    {
+        live++;
+    }
+
+    CountedKey(const CountedKey& other)
+        : value(other.value)
+    {
+        live++;
+    }
+
+    CountedKey& operator=(const CountedKey& other) = default;
+
+    ~CountedKey()
+    {
+        live--;
+    }
+
+    bool operator<(const CountedKey& other) const
+    {
+        return this->value < other.value;
+    }
+
+    bool operator==(const CountedKey& other) const
+    {
+        return this->value == other.value;
+    }
+};
+
+TEST_CASE("Exceção do gerador de chaves")
+{
+    int next = 0;
+
+    auto failing = [&]() -> CountedKey {
+        if (next == 5)
+            throw std::runtime_error("No more keys");
+
+        return CountedKey(next++);
+    };
+
+    CHECK_THROWS_AS((rbtree::FrozenSet<CountedKey>(10, failing)), std::runtime_error);
+    CHECK(CountedKey::live == 0);
+
+    next = 0;
+
+    CHECK_NOTHROW((rbtree::FrozenSet<CountedKey>(5, failing)));
+    CHECK(CountedKey::live == 0);
+}
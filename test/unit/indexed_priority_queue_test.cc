@@ -0,0 +1,168 @@
+/*
+ * Filename: indexed_priority_queue_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "indexed_priority_queue.h"
+
+TEST_CASE("Indexed Priority Queue: Inserir/Remover elemento")
+{
+    bheap::IndexedPriorityQueue<int> pqueue;
+
+    SUBCASE("Fila vazia")
+    {
+        CHECK_THROWS_AS(pqueue.Peek(), std::overflow_error);
+        CHECK_THROWS_AS(pqueue.PeekHandle(), std::overflow_error);
+        CHECK_THROWS_AS(pqueue.Dequeue(), std::underflow_error);
+        CHECK_THROWS_AS(pqueue.Remove(0), std::out_of_range);
+        CHECK_FALSE(pqueue.Contains(0));
+    }
+
+    SUBCASE("Ordem de remoção")
+    {
+        for (int value : { 2, 4, 1, 6, 3, 3, 10, 0 })
+            pqueue.Enqueue(value);
+
+        for (int value : { 0, 1, 2, 3, 3, 4, 6, 10 })
+            CHECK(pqueue.Dequeue() == value);
+
+        CHECK(pqueue.IsEmpty());
+    }
+}
+
+TEST_CASE("Indexed Priority Queue: DecreaseKey, IncreaseKey, Update e Remove")
+{
+    bheap::IndexedPriorityQueue<int> pqueue;
+
+    auto a = pqueue.Push(50);
+    auto b = pqueue.Push(20);
+    auto c = pqueue.Push(30);
+    auto d = pqueue.Push(40);
+
+    CHECK(pqueue.PeekHandle() == b);
+
+    pqueue.DecreaseKey(d, 10);
+    CHECK(pqueue.PeekHandle() == d);
+    CHECK(pqueue.Get(d) == 10);
+    CHECK_THROWS_AS(pqueue.DecreaseKey(d, 11), std::invalid_argument);
+
+    pqueue.IncreaseKey(d, 60);
+    CHECK(pqueue.PeekHandle() == b);
+    CHECK_THROWS_AS(pqueue.IncreaseKey(d, 59), std::invalid_argument);
+
+    pqueue.Update(a, 5);
+    CHECK(pqueue.Peek() == 5);
+    pqueue.Update(a, 55);
+    CHECK(pqueue.Peek() == 20);
+
+    CHECK(pqueue.Remove(c) == 30);
+    CHECK_FALSE(pqueue.Contains(c));
+    CHECK_THROWS_AS(pqueue.Get(c), std::out_of_range);
+    CHECK(pqueue.Size() == 3);
+
+    // The slot of a removed handle may be given to a new element, but the old
+    // handle stays invalid
+    auto e = pqueue.Push(1);
+    CHECK(pqueue.Get(e) == 1);
+    CHECK(e != c);
+    CHECK_FALSE(pqueue.Contains(c));
+    CHECK_THROWS_AS(pqueue.Get(c), std::out_of_range);
+    CHECK_THROWS_AS(pqueue.Remove(c), std::out_of_range);
+
+    for (int value : { 1, 20, 55, 60 })
+        CHECK(pqueue.Dequeue() == value);
+
+    auto f = pqueue.Push(7);
+    pqueue.Clear();
+    CHECK(pqueue.IsEmpty());
+    CHECK_FALSE(pqueue.Contains(0));
+    CHECK_FALSE(pqueue.Contains(f));
+
+    // Handles given before Clear do not match the elements pushed after it
+    auto g = pqueue.Push(8);
+    CHECK(g != f);
+    CHECK_FALSE(pqueue.Contains(f));
+    CHECK_THROWS_AS(pqueue.Update(f, 0), std::out_of_range);
+    CHECK(pqueue.Get(g) == 8);
+}
+
+TEST_CASE("Indexed Priority Queue: Handles estáveis sob operações aleatórias")
+{
+    using Greater = decltype(comparators::Greater<int>);
+    using Queue   = bheap::IndexedPriorityQueue<int, Greater>;
+    using Handle  = Queue::Handle;
+
+    Queue pqueue;
+
+    std::mt19937                    generator(7);
+    std::vector<Handle>             handles;  // Every handle given by Push
+    std::unordered_map<Handle, int> expected; // Value of each handle still queued
+
+    for (int step = 0; step < 20000; step++)
+    {
+        std::size_t operation = generator() % 4;
+        int         value     = static_cast<int>(generator() % 100000);
+
+        if (operation == 0 or pqueue.IsEmpty())
+        {
+            Handle handle = pqueue.Push(value);
+
+            CHECK(expected.count(handle) == 0);
+
+            handles.push_back(handle);
+            expected[handle] = value;
+            continue;
+        }
+
+        Handle handle = handles[generator() % handles.size()];
+
+        // Handles of elements that left the queue stay stale after their slot is reused
+        if (expected.count(handle) == 0)
+        {
+            CHECK_FALSE(pqueue.Contains(handle));
+            CHECK_THROWS_AS(pqueue.Update(handle, value), std::out_of_range);
+            continue;
+        }
+
+        if (operation == 1)
+        {
+            pqueue.Update(handle, value);
+            expected[handle] = value;
+        }
+        else if (operation == 2)
+        {
+            CHECK(pqueue.Remove(handle) == expected[handle]);
+            expected.erase(handle);
+        }
+        else
+        {
+            int top = std::max_element(expected.begin(),
+                                       expected.end(),
+                                       [](const auto& a, const auto& b) {
+                                           return a.second < b.second;
+                                       })
+                          ->second;
+
+            CHECK(pqueue.Peek() == top);
+            CHECK(expected.at(pqueue.PeekHandle()) == top);
+
+            expected.erase(pqueue.PeekHandle());
+            CHECK(pqueue.Dequeue() == top);
+        }
+    }
+
+    CHECK(pqueue.Size() == expected.size());
+
+    for (const auto& [handle, value] : expected)
+        CHECK(pqueue.Get(handle) == value);
+}
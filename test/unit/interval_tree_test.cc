@@ -0,0 +1,167 @@
+/*
+ * Filename: interval_tree_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "doctest.h"
+
+#include "interval_tree.h"
+
+using IntervalT = rbtree::Interval<int, int>;
+
+// Every interval of 'intervals' that overlaps [low, high], sorted
+static std::vector<std::tuple<int, int, int>>
+BruteForce(const std::vector<IntervalT>& intervals, int low, int high)
+{
+    std::vector<std::tuple<int, int, int>> result;
+
+    for (const IntervalT& interval : intervals)
+        if (interval.low <= high and low <= interval.high)
+            result.emplace_back(interval.low, interval.high, interval.value);
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+static std::vector<std::tuple<int, int, int>>
+Query(rbtree::IntervalTree<int, int>& tree, int low, int high)
+{
+    std::vector<std::tuple<int, int, int>> result;
+
+    tree.Overlapping(low, high, [&](int a, int b, int value) {
+        result.emplace_back(a, b, value);
+    });
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+TEST_CASE("Consultas de sobreposição na árvore de intervalos")
+{
+    rbtree::IntervalTree<int, int> tree;
+    std::vector<IntervalT>         intervals;
+    std::mt19937                   random(7);
+
+    CHECK(tree.IsEmpty());
+    CHECK_THROWS_AS(tree.Insert(5, 4, 0), std::invalid_argument);
+
+    for (int i = 0; i < 2000; i++)
+    {
+        int low  = static_cast<int>(random() % 10000);
+        int high = low + static_cast<int>(random() % 200);
+
+        tree.Insert(low, high, i);
+        intervals.emplace_back(low, high, i);
+    }
+
+    CHECK(tree.Size() == 2000);
+    CHECK_NOTHROW(tree.Validate());
+
+    for (int i = 0; i < 200; i++)
+    {
+        int low  = static_cast<int>(random() % 10300) - 150;
+        int high = low + static_cast<int>(random() % 300);
+
+        CHECK(Query(tree, low, high) == BruteForce(intervals, low, high));
+    }
+
+    std::vector<std::tuple<int, int, int>> stabbed;
+    tree.Stabbing(5000, [&](int a, int b, int value) {
+        stabbed.emplace_back(a, b, value);
+    });
+    std::sort(stabbed.begin(), stabbed.end());
+
+    CHECK(stabbed == BruteForce(intervals, 5000, 5000));
+    CHECK(Query(tree, 20000, 30000).empty());
+}
+
+TEST_CASE("Remoção mantém o maior extremo das subárvores")
+{
+    rbtree::IntervalTree<int, int> tree;
+    std::vector<IntervalT>         intervals;
+    std::mt19937                   random(11);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        int low  = static_cast<int>(random() % 5000);
+        int high = low + static_cast<int>(random() % 500);
+
+        tree.Insert(low, high, i);
+        intervals.emplace_back(low, high, i);
+    }
+
+    std::shuffle(intervals.begin(), intervals.end(), random);
+
+    // Removing equal endpoints may remove a different copy, so only the
+    // endpoints are compared
+    while (intervals.size() > 200)
+    {
+        CHECK(tree.Remove(intervals.back().low, intervals.back().high));
+        intervals.pop_back();
+
+        if (intervals.size() % 100 == 0)
+        {
+            CHECK_NOTHROW(tree.Validate());
+
+            std::size_t expected = BruteForce(intervals, 2000, 2100).size();
+            std::size_t found    = 0;
+
+            tree.Overlapping(2000, 2100, [&](int, int, int) { found++; });
+            CHECK(found == expected);
+        }
+    }
+
+    CHECK_FALSE(tree.Remove(-1, -1));
+    CHECK(tree.Size() == 200);
+
+    tree.Clear();
+    CHECK(tree.IsEmpty());
+}
+
+TEST_CASE("Construção em O(n) a partir de intervalos ordenados")
+{
+    for (std::size_t n = 0; n < 130; n++)
+    {
+        rbtree::IntervalTree<int, int> tree;
+        std::vector<IntervalT>         intervals;
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            int low = static_cast<int>(i / 2);
+            intervals.emplace_back(low, low + static_cast<int>(i % 7), i);
+        }
+
+        std::sort(intervals.begin(),
+                  intervals.end(),
+                  rbtree::IntervalLess<int, int>);
+
+        tree.Build(intervals);
+
+        CHECK(tree.Size() == n);
+        CHECK_NOTHROW(tree.Validate());
+        CHECK(Query(tree, 10, 20) == BruteForce(intervals, 10, 20));
+
+        // The built tree keeps working as a regular one
+        tree.Insert(3, 100, -1);
+        intervals.emplace_back(3, 100, -1);
+
+        CHECK_NOTHROW(tree.Validate());
+        CHECK(Query(tree, 50, 60) == BruteForce(intervals, 50, 60));
+    }
+
+    rbtree::IntervalTree<int, int> tree;
+    std::vector<IntervalT>         unsorted = { IntervalT(5, 6, 0),
+                                                IntervalT(1, 2, 0) };
+    std::vector<IntervalT>         inverted = { IntervalT(1, 0, 0) };
+
+    CHECK_THROWS_AS(tree.Build(unsorted), std::invalid_argument);
+    CHECK_THROWS_AS(tree.Build(inverted), std::invalid_argument);
+}
@@ -5,11 +5,13 @@
  */
 
 #include <cstdint>
+#include <memory>
 #include <stdexcept>
 
 #include "doctest.h"
 
 #include "list_dlkd.h"
+#include "reclaimer.h"
 
 TEST_CASE("Remover elemento")
 {
@@ -188,3 +190,76 @@ TEST_CASE("Insert with position")
         CHECK(it->GetValue() == 31);
     }
 }
+
+TEST_CASE("Operações com handles de nós")
+{
+    dlkd::List<uint32_t> list;
+
+    dlkd::Node<uint32_t>* two = list.PushFront(2);
+    dlkd::Node<uint32_t>* one = list.PushFront(1);
+    list.PushBack(3);
+
+    REQUIRE(list.Size() == 3);
+    CHECK(list.GetHeadNode() == one);
+    CHECK(list.GetTailNode()->GetValue() == 3);
+
+    SUBCASE("Move to front")
+    {
+        list.MoveToFront(list.GetTailNode());
+        CHECK(list.Front() == 3);
+        CHECK(list.Back() == 2);
+
+        list.MoveToFront(two);
+        CHECK(list.Front() == 2);
+        CHECK(list.Back() == 1);
+        CHECK(list.GetHeadNode()->GetRightNode()->GetValue() == 3);
+        CHECK(list.GetTailNode()->GetLeftNode()->GetValue() == 3);
+
+        list.MoveToFront(two);
+        CHECK(list.Front() == 2);
+        CHECK(list.Size() == 3);
+    }
+
+    SUBCASE("Erase")
+    {
+        list.Erase(two);
+        CHECK(list.Size() == 2);
+        CHECK(one->GetRightNode() == list.GetTailNode());
+
+        list.Erase(list.GetTailNode());
+        list.Erase(one);
+        CHECK(list.IsEmpty());
+        CHECK(list.GetHeadNode() == nullptr);
+        CHECK(list.GetTailNode() == nullptr);
+    }
+}
+
+TEST_CASE("Esvaziamento incremental e em segundo plano da lista")
+{
+    dlkd::List<std::shared_ptr<int>> list;
+    std::shared_ptr<int>             token = std::make_shared<int>(0);
+
+    for (int i = 0; i < 100; i++)
+        list.PushBack(token);
+
+    CHECK_FALSE(list.ClearSome(30));
+    CHECK(list.Size() == 0);
+    CHECK(token.use_count() == 71);
+
+    list.PushBack(token);
+
+    while (not list.ClearSome(30))
+        ;
+
+    CHECK(list.Size() == 1);
+    CHECK(token.use_count() == 2);
+
+    for (int i = 0; i < 100; i++)
+        list.PushFront(token);
+
+    list.ClearAsync();
+    CHECK(list.Size() == 0);
+
+    utils::Reclaimer::Instance().Drain();
+    CHECK(token.use_count() == 1);
+}
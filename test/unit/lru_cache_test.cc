@@ -0,0 +1,137 @@
+/*
+ * Filename: lru_cache_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "doctest.h"
+
+#include "lru_cache.h"
+
+TEST_CASE("Cache LRU com capacidade por quantidade")
+{
+    lru::LruCache<uint32_t, std::string> cache(3);
+
+    cache.Put(1, "one");
+    cache.Put(2, "two");
+    cache.Put(3, "three");
+
+    CHECK(cache.Size() == 3);
+    CHECK(cache.Weight() == 3);
+
+    SUBCASE("Evicts the least recently used entry")
+    {
+        // 1 becomes the most recently used, so 2 is evicted
+        REQUIRE(cache.Get(1) != nullptr);
+        CHECK(*cache.Get(1) == "one");
+
+        cache.Put(4, "four");
+
+        CHECK(cache.Size() == 3);
+        CHECK_FALSE(cache.Contains(2));
+        CHECK(cache.Contains(1));
+        CHECK(cache.Contains(3));
+        CHECK(cache.Contains(4));
+        CHECK(cache.Evictions() == 1);
+    }
+
+    SUBCASE("Update an existing key")
+    {
+        cache.Put(1, "uno");
+        cache.Put(4, "four");
+
+        CHECK(cache.Size() == 3);
+        CHECK(*cache.Get(1) == "uno");
+        CHECK_FALSE(cache.Contains(2));
+    }
+
+    SUBCASE("Counters")
+    {
+        cache.Get(1);
+        cache.Get(2);
+        cache.Get(10);
+
+        CHECK(cache.Hits() == 2);
+        CHECK(cache.Misses() == 1);
+
+        cache.ResetStats();
+        CHECK(cache.Hits() == 0);
+        CHECK(cache.Misses() == 0);
+    }
+
+    SUBCASE("Remove, Evict and Clear")
+    {
+        CHECK(cache.Remove(2));
+        CHECK_FALSE(cache.Remove(2));
+        CHECK(cache.Size() == 2);
+
+        cache.Evict();
+        CHECK_FALSE(cache.Contains(1));
+        CHECK(cache.Size() == 1);
+
+        cache.Clear();
+        CHECK(cache.IsEmpty());
+        CHECK(cache.Weight() == 0);
+        CHECK_THROWS_AS(cache.Evict(), std::underflow_error);
+    }
+}
+
+TEST_CASE("Cache LRU com capacidade por bytes")
+{
+    using Cache = lru::LruCache<uint32_t,
+                                std::string,
+                                decltype(lru::BySize<uint32_t, std::string>)>;
+
+    std::size_t entry = lru::BySize<uint32_t, std::string>(0, std::string(100, 'x'));
+    Cache       cache(3 * entry);
+
+    for (uint32_t i = 0; i < 10; i++)
+        cache.Put(i, std::string(100, 'x'));
+
+    CHECK(cache.Size() == 3);
+    CHECK(cache.Weight() == 3 * entry);
+    CHECK(cache.Contains(9));
+    CHECK_FALSE(cache.Contains(6));
+
+    // A bigger entry takes the room of two smaller ones
+    cache.Put(100, std::string(300, 'y'));
+    CHECK(cache.Contains(100));
+    CHECK(cache.Weight() <= cache.Capacity());
+
+    // An entry larger than the whole cache is not stored
+    cache.Put(200, std::string(10 * entry, 'z'));
+    CHECK_FALSE(cache.Contains(200));
+
+    CHECK_THROWS_AS(Cache(0), std::invalid_argument);
+}
+
+TEST_CASE("Cache LRU com valor alterado por Get")
+{
+    using Cache = lru::LruCache<uint32_t,
+                                std::string,
+                                decltype(lru::BySize<uint32_t, std::string>)>;
+
+    std::size_t entry = lru::BySize<uint32_t, std::string>(0, std::string(10, 'x'));
+    Cache       cache(100 * entry);
+
+    cache.Put(1, std::string(10, 'x'));
+    cache.Put(2, std::string(10, 'x'));
+
+    // The entry is still weighed as it was when it was put
+    cache.Get(1)->append(500, 'y');
+    CHECK(cache.Weight() == 2 * entry);
+
+    CHECK(cache.Remove(1));
+    CHECK(cache.Weight() == entry);
+
+    cache.Evict();
+    CHECK(cache.Weight() == 0);
+
+    cache.Put(3, std::string(10, 'x'));
+    CHECK(cache.Contains(3));
+    CHECK(cache.Weight() == entry);
+}
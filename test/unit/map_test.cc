@@ -5,10 +5,16 @@
  */
 
 #include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "doctest.h"
 
 #include "map.h"
+#include "reclaimer.h"
 
 TEST_CASE("Inserção e busca")
 {
@@ -157,3 +163,212 @@ TEST_CASE("Get method")
 
     CHECK_THROWS(map.Get(10));
 }
+
+TEST_CASE("Union de maps")
+{
+    rbtree::Map<uint32_t, std::string> map1;
+    rbtree::Map<uint32_t, std::string> map2;
+
+    map1.Insert(1, "One");
+    map1.Insert(2, "Two");
+    map2.Insert(2, "Dois");
+    map2.Insert(3, "Três");
+
+    map1.Union(map2);
+
+    CHECK(map1.Size() == 3);
+    CHECK(map2.IsEmpty());
+    CHECK(map1.Get(2) == "Two");
+    CHECK(map1.Get(3) == "Três");
+
+    map1.Split(2, map2);
+
+    CHECK(map1.Size() == 1);
+    CHECK(map2.Size() == 2);
+    CHECK(map2.Contains(2));
+}
+
+TEST_CASE("Operações em lote no map")
+{
+    rbtree::Map<uint32_t, std::string> map;
+
+    std::vector<Pair<uint32_t, std::string>> pairs;
+    for (uint32_t i = 0; i < 100; i++)
+        pairs.push_back(Pair<uint32_t, std::string>(99 - i, std::to_string(99 - i)));
+
+    map.Insert(5, "Five");
+    map.InsertBatch(pairs);
+
+    CHECK(map.Size() == 100);
+    CHECK(map.Get(5) == "Five");
+
+    std::vector<uint32_t>     keys = { 0, 5, 99, 100, 1000 };
+    std::vector<std::string*> values(keys.size());
+    bool                      found[5];
+
+    map.GetBatch(keys, values);
+    map.ContainsBatch(keys, found);
+
+    CHECK(*values[0] == "0");
+    CHECK(*values[1] == "Five");
+    CHECK(*values[2] == "99");
+    CHECK(values[3] == nullptr);
+    CHECK(values[4] == nullptr);
+
+    CHECK(found[0]);
+    CHECK(found[2]);
+    CHECK_FALSE(found[3]);
+    CHECK_FALSE(found[4]);
+}
+
+TEST_CASE("Inserção com dica no map")
+{
+    rbtree::Map<uint32_t, uint32_t> map;
+
+    for (uint32_t i = 0; i < 100; i += 10)
+        map.Append(i, i);
+
+    // Each key goes right after the node returned by the previous insertion
+    for (uint32_t i = 0; i < 100; i += 10)
+    {
+        auto hint = map.Insert(i, 0);
+
+        for (uint32_t j = i + 1; j < i + 10; j++)
+            hint = map.Insert(hint, j, j);
+    }
+
+    map.Insert(map.end(), 100, 100);
+    map.Insert(map.begin(), 0, 1);
+
+    CHECK(map.Size() == 101);
+
+    uint32_t expected = 0;
+    for (auto& pair : map)
+    {
+        CHECK(pair.GetFirst() == expected);
+        CHECK(pair.GetSecond() == expected);
+        expected++;
+    }
+
+    CHECK(expected == 101);
+}
+
+TEST_CASE("Multimap com InsertMulti")
+{
+    rbtree::Map<uint32_t, std::string> map;
+
+    map.Insert(2, "b");
+    map.InsertMulti(1, "a");
+    map.InsertMulti(2, "c");
+    map.InsertMulti(2, "d");
+    map.InsertMulti(3, "e");
+
+    CHECK(map.Size() == 5);
+    CHECK(map.Count(2) == 3);
+    CHECK(map.Count(4) == 0);
+
+    // Copies of a key come out in insertion order
+    std::string values;
+    auto        range = map.EqualRange(2);
+
+    for (auto it = range.GetFirst(); it != range.GetSecond(); it++)
+        values += (*it).GetSecond();
+
+    CHECK(values == "bcd");
+    CHECK(map.RemoveAll(2) == 3);
+    CHECK(map.Size() == 2);
+    CHECK_FALSE(map.Contains(2));
+    CHECK_NOTHROW(map.Validate());
+}
+
+TEST_CASE("Compactação do map")
+{
+    rbtree::Map<uint32_t, std::string> map;
+
+    for (uint32_t i = 0; i < 500; i++)
+        map.Insert((i * 31) % 500, std::to_string(i));
+
+    while (not map.CompactStep(64))
+        map.Remove(map.Size() % 500);
+
+    CHECK_NOTHROW(map.Validate());
+
+    uint32_t previous = 0;
+    bool     first    = true;
+
+    for (auto& pair : map)
+    {
+        CHECK((first or previous < pair.GetFirst()));
+        CHECK(pair.GetSecond() == std::to_string((pair.GetFirst() * 371) % 500));
+        previous = pair.GetFirst();
+        first    = false;
+    }
+}
+
+static rbtree::Map<uint32_t, std::string> MakeMap(uint32_t size)
+{
+    rbtree::Map<uint32_t, std::string> map;
+
+    for (uint32_t i = 0; i < size; i++)
+        map.Insert(i, std::to_string(i));
+
+    return map;
+}
+
+TEST_CASE("Cópia e movimentação de maps")
+{
+    rbtree::Map<uint32_t, std::string> map = MakeMap(200);
+    rbtree::Map<uint32_t, std::string> copy(map);
+
+    copy[5] = "five";
+    map.Remove(6);
+
+    CHECK(map[5] == "5");
+    CHECK(copy[5] == "five");
+    CHECK(copy.Contains(6));
+    CHECK_NOTHROW(copy.Validate());
+
+    // A map handed to another thread by moving it
+    std::size_t size = 0;
+    std::thread worker([&size, moved = std::move(copy)]() { size = moved.Size(); });
+    worker.join();
+
+    CHECK(size == 200);
+    CHECK(copy.IsEmpty());
+
+    copy = map;
+    CHECK(copy.Size() == 199);
+
+    rbtree::Map<uint32_t, std::string> other = MakeMap(3);
+
+    other.Swap(copy);
+    CHECK(other.Size() == 199);
+    CHECK(copy.Size() == 3);
+    CHECK(copy[2] == "2");
+}
+
+TEST_CASE("Esvaziamento do map em segundo plano")
+{
+    rbtree::Map<uint32_t, std::shared_ptr<int>> map;
+    std::shared_ptr<int>                        token = std::make_shared<int>(0);
+
+    for (uint32_t i = 0; i < 1000; i++)
+        map.Insert(i, token);
+
+    map.ClearAsync();
+    CHECK(map.IsEmpty());
+
+    map.Insert(1, token);
+    utils::Reclaimer::Instance().Drain();
+
+    // Only the element inserted after ClearAsync still holds the token
+    CHECK(token.use_count() == 2);
+
+    for (uint32_t i = 0; i < 100; i++)
+        map.Insert(i, token);
+
+    while (not map.ClearSome(10))
+        CHECK(map.IsEmpty());
+
+    CHECK(token.use_count() == 1);
+}
@@ -0,0 +1,200 @@
+/*
+ * Filename: mapped_map_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "doctest.h"
+
+#include "map.h"
+#include "mapped_map.h"
+
+static std::string SnapshotPath(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+TEST_CASE("Exportação e leitura de um map mapeado em memória")
+{
+    rbtree::Map<uint64_t, double> map;
+
+    // Enough keys to fill several pages of the sparse index
+    for (uint64_t i = 0; i < 5000; i++)
+        map.Insert(i * 2, static_cast<double>(i) / 2);
+
+    for (bool sparseIndex : { true, false })
+    {
+        std::string path = SnapshotPath("mapped_map_test.snapshot");
+        map.Export(path, sparseIndex);
+
+        rbtree::MappedMap<uint64_t, double> mapped(path);
+
+        CHECK(mapped.Size() == 5000);
+
+        for (uint64_t i = 0; i < 10001; i++)
+        {
+            CHECK(mapped.Contains(i) == (i % 2 == 0 and i < 10000));
+
+            if (i % 2 == 0 and i < 10000)
+                CHECK(mapped.Get(i) == static_cast<double>(i / 2) / 2);
+        }
+
+        CHECK_THROWS_AS(mapped.Get(1), std::out_of_range);
+        CHECK(mapped.Search(9999) == nullptr);
+
+        uint64_t count = 0;
+        uint64_t first = 0;
+
+        mapped.Range(101, 200, [&](const uint64_t& key, const double& value) {
+            if (count == 0)
+                first = key;
+
+            CHECK(value == static_cast<double>(key / 2) / 2);
+            count++;
+        });
+
+        CHECK(first == 102);
+        CHECK(count == 50);
+
+        std::filesystem::remove(path);
+    }
+}
+
+TEST_CASE("Snapshot de um map vazio")
+{
+    rbtree::Map<uint32_t, uint32_t> map;
+    std::string                     path = SnapshotPath("mapped_map_empty.snapshot");
+
+    map.Export(path);
+
+    rbtree::MappedMap<uint32_t, uint32_t> mapped(path);
+
+    CHECK(mapped.IsEmpty());
+    CHECK_FALSE(mapped.Contains(0));
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Exportação sobre um snapshot em uso")
+{
+    std::string path = SnapshotPath("mapped_map_replace.snapshot");
+
+    rbtree::Map<uint64_t, uint64_t> map;
+
+    for (uint64_t i = 0; i < 3000; i++)
+        map.Insert(i, i);
+
+    map.Export(path);
+
+    rbtree::MappedMap<uint64_t, uint64_t> old(path);
+
+    // A smaller snapshot replaces the file while the old one is still mapped
+    map.Clear();
+    map.Insert(7, 70);
+    map.Export(path);
+
+    CHECK(old.Size() == 3000);
+    CHECK(old.Get(2999) == 2999);
+    CHECK_FALSE(std::filesystem::exists(path + ".tmp"));
+
+    rbtree::MappedMap<uint64_t, uint64_t> fresh(path);
+
+    CHECK(fresh.Size() == 1);
+    CHECK(fresh.Get(7) == 70);
+
+    // The mapping and the comparators move to the old map
+    old = std::move(fresh);
+
+    CHECK(old.Size() == 1);
+    CHECK(old.Get(7) == 70);
+    CHECK_FALSE(old.Contains(2999));
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Arquivos inválidos")
+{
+    std::string path = SnapshotPath("mapped_map_invalid.snapshot");
+
+    CHECK_THROWS_AS((rbtree::MappedMap<uint32_t, uint32_t>(path + ".missing")),
+                    std::runtime_error);
+
+    std::ofstream(path) << "not a snapshot";
+    CHECK_THROWS_AS((rbtree::MappedMap<uint32_t, uint32_t>(path)), std::runtime_error);
+
+    // Same file format but different key and value types
+    rbtree::Map<uint32_t, uint32_t> map;
+    map.Insert(1, 1);
+    map.Export(path);
+
+    CHECK_THROWS_AS((rbtree::MappedMap<uint64_t, uint32_t>(path)), std::runtime_error);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Cabeçalho corrompido")
+{
+    std::string path = SnapshotPath("mapped_map_corrupt.snapshot");
+
+    rbtree::Map<uint64_t, uint64_t> map;
+
+    for (uint64_t i = 0; i < 2000; i++)
+        map.Insert(i, i);
+
+    // Export a valid snapshot, then overwrite its header with a patched copy
+    auto corrupt = [&](auto patch) {
+        map.Export(path);
+
+        rbtree::MappedMapHeader header;
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        patch(header);
+        file.seekp(0);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    };
+
+    using Header = rbtree::MappedMapHeader;
+    using Mapped = rbtree::MappedMap<uint64_t, uint64_t>;
+
+    corrupt([](Header&) {});
+    CHECK_NOTHROW((Mapped(path)));
+
+    // Index entries that point past the last key
+    corrupt([](Header& header) { header.indexStride = header.size; });
+    CHECK_THROWS_AS((Mapped(path)), std::runtime_error);
+
+    corrupt([](Header& header) { header.indexStride = UINT64_MAX / 2; });
+    CHECK_THROWS_AS((Mapped(path)), std::runtime_error);
+
+    corrupt([](Header& header) { header.indexStride = 0; });
+    CHECK_THROWS_AS((Mapped(path)), std::runtime_error);
+
+    // Sections that do not start on a key or value boundary
+    corrupt([](Header& header) { header.keysOffset += 1; });
+    CHECK_THROWS_AS((Mapped(path)), std::runtime_error);
+
+    corrupt([](Header& header) { header.valuesOffset += 4; });
+    CHECK_THROWS_AS((Mapped(path)), std::runtime_error);
+
+    corrupt([](Header& header) { header.indexOffset += 2; });
+    CHECK_THROWS_AS((Mapped(path)), std::runtime_error);
+
+    // A valid header whose stride is smaller than the one the index was built
+    // with still only reads keys of the file
+    corrupt([](Header& header) { header.indexStride = 1; });
+
+    Mapped mapped(path);
+
+    for (uint64_t key : { 0, 1, 511, 512, 1999, 5000 })
+        CHECK((mapped.Search(key) == nullptr or *mapped.Search(key) == key));
+
+    std::filesystem::remove(path);
+}
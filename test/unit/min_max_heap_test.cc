@@ -0,0 +1,179 @@
+/*
+ * Filename: min_max_heap_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "min_max_heap.h"
+
+TEST_CASE("Min-max heap: Inserir/Remover elemento")
+{
+    bheap::MinMaxHeap<int> heap;
+
+    SUBCASE("Heap vazio")
+    {
+        CHECK(heap.IsEmpty());
+        CHECK_FALSE(heap.IsFull());
+        CHECK(heap.Capacity() == 0);
+        CHECK_THROWS_AS(heap.PeekMin(), std::overflow_error);
+        CHECK_THROWS_AS(heap.PeekMax(), std::overflow_error);
+        CHECK_THROWS_AS(heap.PopMin(), std::underflow_error);
+        CHECK_THROWS_AS(heap.PopMax(), std::underflow_error);
+    }
+
+    SUBCASE("Remoção pelas duas pontas")
+    {
+        for (int value : { 5, 1, 9, 3, 7, 3, 10, 0 })
+            CHECK(heap.Push(value));
+
+        CHECK(heap.Size() == 8);
+        CHECK(heap.PeekMin() == 0);
+        CHECK(heap.PeekMax() == 10);
+
+        CHECK(heap.PopMax() == 10);
+        CHECK(heap.PopMin() == 0);
+        CHECK(heap.PopMax() == 9);
+        CHECK(heap.PopMax() == 7);
+        CHECK(heap.PopMin() == 1);
+        CHECK(heap.PopMin() == 3);
+        CHECK(heap.PopMax() == 5);
+        CHECK(heap.PeekMin() == 3);
+        CHECK(heap.PeekMax() == 3);
+        CHECK(heap.PopMin() == 3);
+        CHECK(heap.IsEmpty());
+    }
+
+    SUBCASE("Comparador maior")
+    {
+        bheap::MinMaxHeap<int, decltype(comparators::Greater<int>)> maxFirst;
+
+        for (int value : { 4, 8, 2, 6 })
+            maxFirst.Push(value);
+
+        CHECK(maxFirst.PeekMin() == 8);
+        CHECK(maxFirst.PeekMax() == 2);
+    }
+
+    SUBCASE("Construção a partir de um intervalo")
+    {
+        std::vector<int>       values = { 12, 4, 19, 7, 1, 15, 8, 8, 3, 20, 11 };
+        bheap::MinMaxHeap<int> built(values.begin(), values.end());
+
+        std::sort(values.begin(), values.end());
+
+        for (std::size_t i = 0; i < values.size(); i += 2)
+        {
+            CHECK(built.PopMin() == values[i / 2]);
+
+            if (not built.IsEmpty())
+                CHECK(built.PopMax() == values[values.size() - 1 - i / 2]);
+        }
+
+        CHECK(built.IsEmpty());
+    }
+}
+
+TEST_CASE("Min-max heap: Modo limitado")
+{
+    CHECK_THROWS_AS(bheap::MinMaxHeap<int>(std::size_t(0)), std::invalid_argument);
+
+    bheap::MinMaxHeap<int> heap(std::size_t(3));
+    int                    evicted = -1;
+
+    CHECK(heap.Capacity() == 3);
+    CHECK_FALSE(heap.Push(5, evicted));
+    CHECK(heap.Push(9));
+    CHECK(heap.Push(7));
+    CHECK(heap.IsFull());
+    CHECK(evicted == -1);
+
+    // A new element after the max one is rejected
+    CHECK_FALSE(heap.Push(9));
+    CHECK(heap.Push(10, evicted));
+    CHECK(evicted == 10);
+
+    // Otherwise the max element leaves
+    CHECK(heap.Push(6, evicted));
+    CHECK(evicted == 9);
+    CHECK(heap.Push(1));
+    CHECK(heap.Size() == 3);
+    CHECK(heap.PeekMin() == 1);
+    CHECK(heap.PeekMax() == 6);
+
+    CHECK(heap.PopMin() == 1);
+    CHECK_FALSE(heap.IsFull());
+    CHECK(heap.Push(100));
+    CHECK(heap.PopMax() == 100);
+}
+
+TEST_CASE("Min-max heap: Carga aleatória")
+{
+    // Every operation is mirrored in a multiset, which gives both ends
+    std::mt19937           random(11);
+    bheap::MinMaxHeap<int> heap;
+    bheap::MinMaxHeap<int> bounded(std::size_t(64));
+    std::multiset<int>     expected;
+    std::multiset<int>     expectedBounded;
+
+    for (int i = 0; i < 30000; i++)
+    {
+        int value = static_cast<int>(random() % 1000);
+
+        switch (random() % 3)
+        {
+            case 0:
+                if (not expected.empty())
+                {
+                    REQUIRE(heap.PopMin() == *expected.begin());
+                    expected.erase(expected.begin());
+                }
+                break;
+
+            case 1:
+                if (not expected.empty())
+                {
+                    REQUIRE(heap.PopMax() == *expected.rbegin());
+                    expected.erase(std::prev(expected.end()));
+                }
+                break;
+
+            default:
+                heap.Push(value);
+                expected.insert(value);
+                break;
+        }
+
+        bool kept = bounded.Push(value);
+
+        if (expectedBounded.size() < 64 or value < *expectedBounded.rbegin())
+        {
+            REQUIRE(kept);
+            expectedBounded.insert(value);
+
+            if (expectedBounded.size() > 64)
+                expectedBounded.erase(std::prev(expectedBounded.end()));
+        }
+        else
+            REQUIRE_FALSE(kept);
+
+        REQUIRE(heap.Size() == expected.size());
+
+        if (not expected.empty())
+        {
+            REQUIRE(heap.PeekMin() == *expected.begin());
+            REQUIRE(heap.PeekMax() == *expected.rbegin());
+        }
+
+        REQUIRE(bounded.PeekMin() == *expectedBounded.begin());
+        REQUIRE(bounded.PeekMax() == *expectedBounded.rbegin());
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ * Filename: multiset_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+
+#include "multiset.h"
+
+TEST_CASE("Inserção e contagem no multiset")
+{
+    rbtree::MultiSet<std::string> multiset;
+
+    CHECK(multiset.IsEmpty());
+
+    multiset.Insert("b");
+    multiset.Insert("a", 3);
+    multiset.Insert("b");
+    multiset.Insert("c", 0);
+
+    CHECK(multiset.Size() == 5);
+    CHECK(multiset.DistinctSize() == 2);
+    CHECK(multiset.Count("a") == 3);
+    CHECK(multiset.Count("b") == 2);
+    CHECK(multiset.Count("c") == 0);
+    CHECK_FALSE(multiset.Contains("c"));
+
+    std::vector<std::string> keys;
+    std::size_t              copies = 0;
+
+    multiset.ForEach([&](const std::string& key, std::size_t count) {
+        keys.push_back(key);
+        copies += count;
+    });
+
+    CHECK(keys == std::vector<std::string>({ "a", "b" }));
+    CHECK(copies == 5);
+}
+
+TEST_CASE("Remoção no multiset")
+{
+    rbtree::MultiSet<int> multiset;
+
+    for (int i = 0; i < 1000; i++)
+        multiset.Insert(i % 10);
+
+    CHECK(multiset.Size() == 1000);
+    CHECK(multiset.DistinctSize() == 10);
+
+    CHECK(multiset.Remove(3));
+    CHECK(multiset.Count(3) == 99);
+    CHECK(multiset.RemoveAll(3) == 99);
+    CHECK_FALSE(multiset.Contains(3));
+    CHECK_FALSE(multiset.Remove(3));
+    CHECK(multiset.RemoveAll(3) == 0);
+
+    // The node of a key goes away with its last copy
+    multiset.Insert(42);
+    CHECK(multiset.Remove(42));
+    CHECK_FALSE(multiset.Contains(42));
+
+    CHECK(multiset.Size() == 900);
+    CHECK(multiset.DistinctSize() == 9);
+
+    multiset.Clear();
+
+    CHECK(multiset.IsEmpty());
+    CHECK(multiset.DistinctSize() == 0);
+}
@@ -0,0 +1,120 @@
+/*
+ * Filename: node_rbtree_compact_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <string>
+
+#include "doctest.h"
+
+#include "map.h"
+#include "node_rbtree_compact.h"
+#include "pair.h"
+#include "red_black_tree.h"
+
+TEST_CASE("Tamanho dos nós compactos")
+{
+    using Value = Pair<int32_t, int32_t>;
+
+    CHECK(sizeof(rbtree::CompactNode<Value>) < sizeof(rbtree::Node<Value>));
+    CHECK(sizeof(rbtree::IndexNode<Value>) < sizeof(rbtree::CompactNode<Value>));
+    CHECK(sizeof(rbtree::IndexNode<Value>) == 3 * sizeof(uint32_t) + sizeof(Value));
+}
+
+template<template<typename> class nodeT>
+void CheckTreeOperations()
+{
+    rbtree::RedBlackTree<int,
+                         decltype(comparators::Less<int>),
+                         decltype(comparators::Equal<int>),
+                         nodeT>
+        tree;
+
+    for (int i = 0; i < 2000; i++)
+        tree.Insert((i * 7919) % 2000);
+
+    CHECK(tree.Size() == 2000);
+    CHECK(tree.IsRedBlackTreeBalanced());
+
+    for (int i = 0; i < 2000; i += 2)
+        tree.Remove(i);
+
+    CHECK(tree.Size() == 1000);
+    CHECK(tree.IsRedBlackTreeBalanced());
+
+    for (int i = 0; i < 2000; i++)
+        CHECK((tree.Search(i) != nullptr) == (i % 2 == 1));
+}
+
+TEST_CASE("Árvore com nós compactos")
+{
+    SUBCASE("CompactNode")
+    {
+        CheckTreeOperations<rbtree::CompactNode>();
+    }
+
+    SUBCASE("IndexNode")
+    {
+        CheckTreeOperations<rbtree::IndexNode>();
+    }
+}
+
+TEST_CASE("Map com nós indexados")
+{
+    rbtree::Map<uint32_t, std::string, rbtree::IndexNode> map;
+    rbtree::Map<uint32_t, std::string, rbtree::IndexNode> other;
+
+    for (uint32_t i = 0; i < 500; i++)
+    {
+        map.Insert(i, std::to_string(i));
+        other.Insert(i + 500, std::to_string(i + 500));
+    }
+
+    CHECK(map.Size() == 500);
+    CHECK(map.Get(42) == "42");
+    CHECK_THROWS_AS(map.Get(1000), std::out_of_range);
+
+    uint32_t expected = 0;
+    for (auto& pair : map)
+        CHECK(pair.GetFirst() == expected++);
+
+    CHECK(expected == 500);
+
+    map.Remove(42);
+    CHECK_FALSE(map.Contains(42));
+
+    map.Union(other);
+    CHECK(map.Size() == 999);
+    CHECK(map.Get(700) == "700");
+
+    // Indexed nodes are copied one by one through their pool
+    rbtree::Map<uint32_t, std::string, rbtree::IndexNode> copy(map);
+
+    map.Remove(700);
+    CHECK(copy.Get(700) == "700");
+    CHECK(copy.Size() == 999);
+    CHECK_NOTHROW(copy.Validate());
+}
+
+TEST_CASE("Reuso de slots do pool de nós")
+{
+    using Pool = rbtree::IndexNodePool<rbtree::IndexNode<int>>;
+
+    rbtree::IndexNode<int>* node  = new rbtree::IndexNode<int>(1);
+    uint32_t                index = Pool::Instance().Index(node);
+
+    CHECK(Pool::Instance().Pointer(index) == node);
+    CHECK(Pool::Instance().Pointer(Pool::NULL_INDEX) == nullptr);
+
+    delete node;
+
+    rbtree::IndexNode<int>* reused = new rbtree::IndexNode<int>(2);
+    CHECK(Pool::Instance().Index(reused) == index);
+    CHECK(reused->GetValue() == 2);
+    CHECK(reused->GetParent() == nullptr);
+    CHECK(reused->GetColor() == rbtree::RED);
+
+    delete reused;
+}
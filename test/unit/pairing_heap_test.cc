@@ -0,0 +1,171 @@
+/*
+ * Filename: pairing_heap_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "pairing_heap.h"
+
+TEST_CASE("Pairing heap: Inserir/Remover elemento")
+{
+    bheap::PairingHeap<int> heap;
+
+    SUBCASE("Heap vazio")
+    {
+        CHECK(heap.IsEmpty());
+        CHECK_THROWS_AS(heap.Peek(), std::overflow_error);
+        CHECK_THROWS_AS(heap.Pop(), std::underflow_error);
+    }
+
+    SUBCASE("Ordem de remoção")
+    {
+        std::vector<int> values;
+        std::mt19937     generator(3);
+
+        for (int i = 0; i < 5000; i++)
+        {
+            values.push_back(static_cast<int>(generator() % 1000));
+            heap.Push(values.back());
+        }
+
+        std::sort(values.begin(), values.end());
+
+        CHECK(heap.Size() == values.size());
+
+        for (int value : values)
+        {
+            CHECK(heap.Peek() == value);
+            CHECK(heap.Pop() == value);
+        }
+
+        CHECK(heap.IsEmpty());
+    }
+
+    SUBCASE("Max heap")
+    {
+        bheap::PairingHeap<int, decltype(comparators::Greater<int>)> maxHeap;
+
+        for (int value : { 2, 4, 1, 6, 3, 3, 10, 0 })
+            maxHeap.Push(value);
+
+        for (int value : { 10, 6, 4, 3, 3, 2, 1, 0 })
+            CHECK(maxHeap.Pop() == value);
+    }
+}
+
+TEST_CASE("Pairing heap: Meld, DecreaseKey e Erase")
+{
+    bheap::PairingHeap<int> a;
+    bheap::PairingHeap<int> b;
+
+    auto five  = a.Push(5);
+    auto nine  = a.Push(9);
+    auto seven = b.Push(7);
+    auto three = b.Push(3);
+
+    a.Meld(b);
+
+    CHECK(b.IsEmpty());
+    CHECK(b.Size() == 0);
+    CHECK(a.Size() == 4);
+    CHECK(a.Peek() == 3);
+
+    // Handles of the melded heap still work
+    a.DecreaseKey(seven, 1);
+    CHECK(a.Peek() == 1);
+    CHECK(a.Get(seven) == 1);
+    CHECK_THROWS_AS(a.DecreaseKey(seven, 2), std::invalid_argument);
+
+    CHECK(a.Erase(three) == 3);
+    CHECK(a.Erase(seven) == 1);
+    CHECK(a.Get(five) == 5);
+    CHECK(a.Get(nine) == 9);
+
+    // The emptied heap can be used again
+    b.Push(4);
+    a.Meld(b);
+
+    for (int value : { 4, 5, 9 })
+        CHECK(a.Pop() == value);
+
+    CHECK(a.IsEmpty());
+}
+
+TEST_CASE("Pairing heap: Operações aleatórias com elementos não triviais")
+{
+    auto less = [](const std::shared_ptr<int>& x, const std::shared_ptr<int>& y) {
+        return *x < *y;
+    };
+
+    bheap::PairingHeap<std::shared_ptr<int>, decltype(less)> heap(less);
+
+    using Handle = decltype(heap)::Handle;
+
+    // Values are kept distinct, so a popped value tells which handle left
+    std::map<int, Handle> byValue;
+    std::mt19937          generator(11);
+
+    auto freshValue = [&](int below) {
+        int value;
+
+        do
+            value = below - 1 - static_cast<int>(generator() % 1000);
+        while (byValue.count(value) != 0);
+
+        return value;
+    };
+
+    for (int step = 0; step < 20000; step++)
+    {
+        std::size_t operation = generator() % 5;
+
+        if (operation <= 1 or byValue.empty())
+        {
+            int value      = freshValue(static_cast<int>(generator() % 1000000));
+            byValue[value] = heap.Push(std::make_shared<int>(value));
+            continue;
+        }
+
+        auto it = byValue.begin();
+        std::advance(it, generator() % byValue.size());
+
+        int    value  = it->first;
+        Handle handle = it->second;
+
+        if (operation == 2)
+        {
+            int lower = freshValue(value);
+
+            heap.DecreaseKey(handle, std::make_shared<int>(lower));
+            byValue.erase(it);
+            byValue[lower] = handle;
+        }
+        else if (operation == 3)
+        {
+            CHECK(*heap.Erase(handle) == value);
+            byValue.erase(it);
+        }
+        else
+        {
+            CHECK(*heap.Peek() == byValue.begin()->first);
+            CHECK(*heap.Pop() == byValue.begin()->first);
+            byValue.erase(byValue.begin());
+        }
+
+        CHECK(heap.Size() == byValue.size());
+    }
+
+    for (auto& [value, handle] : byValue)
+        CHECK(*heap.Get(handle) == value);
+}
@@ -0,0 +1,176 @@
+/*
+ * Filename: persistent_red_black_tree_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "doctest.h"
+
+#include "pair.h"
+#include "persistent_red_black_tree.h"
+
+TEST_CASE("Persistent tree: Inserção, busca e remoção")
+{
+    rbtree::PersistentRedBlackTree<int> tree;
+
+    for (int i = 0; i < 100; i++)
+        CHECK(tree.Insert(i));
+
+    CHECK_FALSE(tree.Insert(50));
+    CHECK(tree.Size() == 100);
+
+    for (int i = 0; i < 100; i += 2)
+        tree.Remove(i);
+
+    // Remover elemento que não está na árvore
+    tree.Remove(0);
+
+    CHECK(tree.Size() == 50);
+
+    for (int i = 0; i < 100; i++)
+        CHECK(tree.Contains(i) == (i % 2 == 1));
+
+    tree.Clear();
+    CHECK(tree.IsEmpty());
+}
+
+TEST_CASE("Persistent tree: Snapshot não muda com escritas")
+{
+    rbtree::PersistentRedBlackTree<int> tree;
+
+    for (int i = 0; i < 64; i++)
+        tree.Insert(i);
+
+    auto snapshot = tree.Snapshot();
+
+    for (int i = 0; i < 64; i += 3)
+        tree.Remove(i);
+
+    for (int i = 64; i < 128; i++)
+        tree.Insert(i);
+
+    CHECK(snapshot.Size() == 64);
+
+    for (int i = 0; i < 128; i++)
+        CHECK(snapshot.Contains(i) == (i < 64));
+
+    int expected = 0;
+    snapshot.ForEach([&expected](const int& value) { CHECK(value == expected++); });
+    CHECK(expected == 64);
+
+    SUBCASE("Snapshot sobrevive à árvore")
+    {
+        tree.Clear();
+        CHECK(snapshot.Contains(10));
+    }
+
+    SUBCASE("Cópia da árvore é independente")
+    {
+        rbtree::PersistentRedBlackTree<int> copy = tree;
+        copy.Insert(-1);
+
+        CHECK(copy.Contains(-1));
+        CHECK_FALSE(tree.Contains(-1));
+        CHECK(copy.Size() == tree.Size() + 1);
+    }
+}
+
+// Comparator whose order is chosen at runtime
+struct SnapshotOrder
+{
+    bool descending = false;
+
+    bool operator()(int a, int b) const
+    {
+        return this->descending ? a > b : a < b;
+    }
+};
+
+TEST_CASE("Persistent tree: Atribuição com comparadores com estado")
+{
+    using Tree = rbtree::PersistentRedBlackTree<int, SnapshotOrder>;
+
+    Tree descending(SnapshotOrder { true });
+    Tree ascending(SnapshotOrder { false });
+
+    for (int i = 0; i < 64; i++)
+        descending.Insert(i);
+
+    // Views and trees take the order their nodes were built with
+    auto view = ascending.Snapshot();
+    view      = descending.Snapshot();
+
+    ascending = descending;
+    ascending.Insert(100);
+
+    for (int i = 0; i < 64; i++)
+    {
+        CHECK(view.Contains(i));
+        CHECK(ascending.Contains(i));
+    }
+
+    CHECK(ascending.Contains(100));
+    CHECK(ascending.Size() == 65);
+
+    // Inserting a key that is already there leaves the shared version intact
+    CHECK_FALSE(ascending.Insert(10));
+    CHECK(view.Size() == 64);
+}
+
+TEST_CASE("Persistent tree: Map com Pair")
+{
+    using PairT = Pair<uint32_t, std::string>;
+
+    rbtree::PersistentRedBlackTree<PairT,
+                                   decltype(comparators::PairLess<uint32_t, std::string>),
+                                   decltype(comparators::PairEqual<uint32_t, std::string>)>
+        map;
+
+    map.Insert(PairT(1, "One"));
+    map.Insert(PairT(2, "Two"));
+
+    auto snapshot = map.Snapshot();
+
+    CHECK_FALSE(map.InsertOrAssign(PairT(1, "Um")));
+    CHECK(map.Search(PairT(1, ""))->GetSecond() == "Um");
+    CHECK(snapshot.Search(PairT(1, ""))->GetSecond() == "One");
+    CHECK(snapshot.Search(PairT(3, "")) == nullptr);
+}
+
+TEST_CASE("Persistent tree: Leitura concorrente de snapshots")
+{
+    rbtree::PersistentRedBlackTree<int> tree;
+
+    for (int i = 0; i < 1000; i++)
+        tree.Insert(i);
+
+    auto snapshot = tree.Snapshot();
+    bool consistent = true;
+
+    std::thread reader([&snapshot, &consistent]() {
+        for (int round = 0; round < 20; round++)
+        {
+            auto copy = snapshot;
+
+            for (int i = 0; i < 1000; i++)
+                consistent = consistent and copy.Contains(i);
+        }
+    });
+
+    for (int i = 0; i < 1000; i++)
+    {
+        tree.Remove(i);
+        tree.Insert(i + 1000);
+    }
+
+    reader.join();
+
+    CHECK(consistent);
+    CHECK(snapshot.Size() == 1000);
+    CHECK(tree.Size() == 1000);
+    CHECK_FALSE(tree.Contains(0));
+}
@@ -5,6 +5,7 @@
  */
 
 #include <stdexcept>
+#include <vector>
 
 #include "doctest.h"
 
@@ -89,3 +90,19 @@ TEST_CASE("Min Priority Queue: Inserir/Remover elemento")
         CHECK(minPQueue.IsEmpty());
     }
 }
+
+TEST_CASE("Priority Queue: Construção a partir de um intervalo")
+{
+    std::vector<int> values = { 9, 4, 7, 1, 8, 2, 2, 6, 0, 5 };
+
+    bheap::PriorityQueue<int, decltype(comparators::Greater<int>)> pqueue(
+        values.begin(),
+        values.end());
+
+    CHECK(pqueue.Size() == values.size());
+
+    for (int value : { 9, 8, 7, 6, 5, 4, 2, 2, 1, 0 })
+        CHECK(pqueue.Dequeue() == value);
+
+    CHECK_THROWS_AS(pqueue.Dequeue(), std::underflow_error);
+}
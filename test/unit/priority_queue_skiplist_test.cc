@@ -0,0 +1,116 @@
+/*
+ * Filename: priority_queue_skiplist_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "doctest.h"
+
+#include "priority_queue_skiplist.h"
+
+TEST_CASE("Skip list Priority Queue: Inserir/Remover elemento")
+{
+    skiplist::PriorityQueue<int, decltype(comparators::Greater<int>)> maxQueue;
+    skiplist::PriorityQueue<int>                                      minQueue;
+
+    SUBCASE("Caso 1: Lista vazia")
+    {
+        CHECK(minQueue.IsEmpty());
+        CHECK(minQueue.begin() == minQueue.end());
+        CHECK_THROWS_AS(minQueue.Peek(), std::overflow_error);
+        CHECK_THROWS_AS(minQueue.Dequeue(), std::underflow_error);
+    }
+
+    SUBCASE("Caso 2: Verificar ordem de remoção")
+    {
+        for (int value : { 2, 4, 1, 6, 3, 3, 10, 0 })
+        {
+            maxQueue.Enqueue(value);
+            minQueue.Enqueue(value);
+        }
+
+        CHECK(minQueue.Size() == 8);
+        CHECK(minQueue.Peek() == 0);
+        CHECK(maxQueue.Peek() == 10);
+
+        std::vector<int> iterated(minQueue.begin(), minQueue.end());
+        CHECK(iterated == std::vector<int> { 0, 1, 2, 3, 3, 4, 6, 10 });
+
+        for (int value : { 10, 6, 4, 3, 3, 2, 1, 0 })
+            CHECK(maxQueue.Dequeue() == value);
+
+        CHECK(maxQueue.IsEmpty());
+
+        minQueue.Clear();
+        CHECK(minQueue.IsEmpty());
+
+        minQueue.Enqueue(5);
+        CHECK(minQueue.Dequeue() == 5);
+    }
+
+    SUBCASE("Caso 3: Prioridades iguais saem na ordem de inserção")
+    {
+        using Entry = std::pair<int, int>; // (priority, insertion order)
+
+        auto byPriority = [](const Entry& a, const Entry& b) {
+            return a.first < b.first;
+        };
+
+        skiplist::PriorityQueue<Entry, decltype(byPriority)> pqueue(byPriority);
+
+        for (int i = 0; i < 300; i++)
+            pqueue.Enqueue(Entry(i % 3, i));
+
+        for (int i = 0; i < 300; i++)
+        {
+            Entry entry = pqueue.Dequeue();
+
+            CHECK(entry.first == i / 100);
+            CHECK(entry.second == entry.first + 3 * (i % 100));
+        }
+    }
+}
+
+TEST_CASE("Skip list Priority Queue: Carga aleatória")
+{
+    // The queue must agree with a stable sort of the same elements
+    using Entry = std::pair<int, int>;
+
+    auto byPriority = [](const Entry& a, const Entry& b) {
+        return a.first < b.first;
+    };
+
+    std::mt19937                                         random(7);
+    skiplist::PriorityQueue<Entry, decltype(byPriority)> pqueue(byPriority);
+    std::vector<Entry>                                   expected;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        if (random() % 3 != 0 or expected.empty())
+        {
+            Entry entry(static_cast<int>(random() % 500), i);
+
+            pqueue.Enqueue(entry);
+            expected.insert(std::upper_bound(expected.begin(),
+                                             expected.end(),
+                                             entry,
+                                             byPriority),
+                            entry);
+        }
+        else
+        {
+            REQUIRE(pqueue.Dequeue() == expected.front());
+            expected.erase(expected.begin());
+        }
+
+        REQUIRE(pqueue.Size() == expected.size());
+    }
+
+    CHECK(std::equal(pqueue.begin(), pqueue.end(), expected.begin(), expected.end()));
+}
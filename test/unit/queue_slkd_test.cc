@@ -6,11 +6,13 @@
 
 #include <ctime>
 #include <cstdlib>
+#include <memory>
 #include <stdexcept>
 
 #include "doctest.h"
 
 #include "queue_slkd.h"
+#include "reclaimer.h"
 
 #define QUEUE_MAX_LENGTH_TEST 10000
 #define QUEUE_MIN_LENGTH_TEST 10
@@ -55,3 +57,31 @@ TEST_CASE("Lançamento de exceções") {
         CHECK_THROWS_AS(queue.Dequeue(), std::underflow_error);
     }
 }
+
+TEST_CASE("Esvaziamento incremental e em segundo plano da fila") {
+    slkd::Queue<std::shared_ptr<int>> queue;
+    std::shared_ptr<int>              token = std::make_shared<int>(0);
+
+    for (int i = 0; i < 100; i++)
+        queue.Enqueue(token);
+
+    CHECK_FALSE(queue.ClearSome(40));
+    CHECK(queue.IsEmpty());
+    CHECK(token.use_count() == 61);
+
+    queue.Enqueue(token);
+    queue.Clear();
+    CHECK(token.use_count() == 1);
+
+    for (int i = 0; i < 100; i++)
+        queue.Enqueue(token);
+
+    queue.ClearAsync();
+    CHECK(queue.IsEmpty());
+
+    queue.Enqueue(token);
+    CHECK(queue.Size() == 1);
+
+    utils::Reclaimer::Instance().Drain();
+    CHECK(token.use_count() == 2);
+}
@@ -0,0 +1,97 @@
+/*
+ * Filename: radix_heap_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "radix_heap.h"
+
+TEST_CASE("Radix heap: Inserir/Remover elemento")
+{
+    bheap::RadixHeap<std::uint32_t, std::string> heap;
+
+    SUBCASE("Fila vazia")
+    {
+        CHECK(heap.IsEmpty());
+        CHECK_THROWS_AS(heap.Peek(), std::overflow_error);
+        CHECK_THROWS_AS(heap.Dequeue(), std::underflow_error);
+    }
+
+    SUBCASE("Ordem de remoção")
+    {
+        heap.Push(7, "sete");
+        heap.Push(2, "dois");
+        heap.Enqueue(Pair<std::uint32_t, std::string>(100, "cem"));
+        heap.Push(0, "zero");
+        heap.Push(7, "sete");
+
+        CHECK(heap.Size() == 5);
+        CHECK(heap.Peek().GetSecond() == "zero");
+        CHECK(heap.Dequeue().GetFirst() == 0);
+        CHECK(heap.Dequeue().GetSecond() == "dois");
+
+        // Keys equal to the last minimum are still accepted
+        heap.Push(2, "dois");
+        CHECK(heap.Dequeue().GetFirst() == 2);
+        CHECK(heap.Dequeue().GetFirst() == 7);
+        CHECK(heap.Dequeue().GetFirst() == 7);
+
+        CHECK_THROWS_AS(heap.Push(6, "seis"), std::invalid_argument);
+
+        CHECK(heap.Dequeue().GetSecond() == "cem");
+        CHECK(heap.IsEmpty());
+
+        heap.Clear();
+        heap.Push(1, "um");
+        CHECK(heap.Peek().GetFirst() == 1);
+    }
+}
+
+TEST_CASE("Radix heap: Carga monótona aleatória")
+{
+    bheap::RadixHeap<std::uint64_t, std::uint64_t> heap;
+
+    std::multiset<std::pair<std::uint64_t, std::uint64_t>> expected;
+    std::mt19937_64                                        generator(5);
+    std::uint64_t                                          last = 0;
+
+    for (std::uint64_t id = 0; id < 20000; id++)
+    {
+        if (generator() % 3 != 0 or expected.empty())
+        {
+            // Offsets of every magnitude, including the whole key range
+            std::uint64_t offset = generator() >> (generator() % 64);
+
+            if (offset > UINT64_MAX - last)
+                offset = UINT64_MAX - last;
+
+            heap.Push(last + offset, id);
+            expected.emplace(last + offset, id);
+            continue;
+        }
+
+        Pair<std::uint64_t, std::uint64_t> top = heap.Dequeue();
+
+        CHECK(top.GetFirst() == expected.begin()->first);
+        CHECK(expected.erase(std::make_pair(top.GetFirst(), top.GetSecond())) == 1);
+
+        last = top.GetFirst();
+    }
+
+    CHECK(heap.Size() == expected.size());
+
+    while (not heap.IsEmpty())
+    {
+        CHECK(heap.Dequeue().GetFirst() == expected.begin()->first);
+        expected.erase(expected.begin());
+    }
+}
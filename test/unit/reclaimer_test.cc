@@ -0,0 +1,37 @@
+/*
+ * Filename: reclaimer_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <thread>
+#include <vector>
+
+#include "doctest.h"
+
+#include "reclaimer.h"
+
+TEST_CASE("Tarefas do reclaimer")
+{
+    utils::Reclaimer& reclaimer = utils::Reclaimer::Instance();
+    std::vector<int>  order;
+    std::thread::id   worker;
+
+    CHECK(&reclaimer == &utils::Reclaimer::Instance());
+
+    for (int i = 0; i < 100; i++)
+        reclaimer.Post([&order, &worker, i]() {
+            order.push_back(i);
+            worker = std::this_thread::get_id();
+        });
+
+    reclaimer.Drain();
+
+    // Jobs run in order, away from the thread that posted them
+    CHECK(reclaimer.Pending() == 0);
+    CHECK(order.size() == 100);
+    CHECK(worker != std::this_thread::get_id());
+
+    for (int i = 0; i < 100; i++)
+        CHECK(order[i] == i);
+}
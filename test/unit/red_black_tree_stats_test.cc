@@ -0,0 +1,118 @@
+/*
+ * Filename: red_black_tree_stats_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+#include "doctest.h"
+
+#include "map.h"
+#include "red_black_tree.h"
+#include "red_black_tree_stats.h"
+
+TEST_CASE("Estatísticas da forma da árvore")
+{
+    rbtree::RedBlackTree<int> tree;
+
+    rbtree::TreeStats empty = tree.Stats();
+
+    CHECK(empty.size == 0);
+    CHECK(empty.height == 0);
+    CHECK(empty.blackHeight == 0);
+    CHECK(empty.depthHistogram.empty());
+
+    // Sequential keys: the worst case of a plain binary search tree
+    for (int i = 0; i < 1023; i++)
+        tree.Insert(i);
+
+    rbtree::TreeStats stats = tree.Stats();
+
+    CHECK(stats.size == 1023);
+    CHECK(stats.height >= 10);
+    CHECK(stats.height <= 2 * stats.blackHeight);
+    CHECK(stats.depthHistogram.size() == stats.height);
+    CHECK(stats.depthHistogram[0] == 1);
+    CHECK(stats.bytes >= 1023 * sizeof(rbtree::Node<int>));
+
+    std::size_t total = 0;
+    for (std::size_t depth = 0; depth < stats.depthHistogram.size(); depth++)
+    {
+        // A binary tree has at most 2^depth nodes at each depth
+        CHECK(stats.depthHistogram[depth] <= (std::size_t(1) << depth));
+        total += stats.depthHistogram[depth];
+    }
+
+    CHECK(total == stats.size);
+
+    std::ostringstream output;
+    output << stats;
+
+    CHECK(output.str().find("rbtree_size 1023\n") != std::string::npos);
+    CHECK(output.str().find("rbtree_depth_nodes{depth=\"0\"} 1\n") !=
+          std::string::npos);
+}
+
+TEST_CASE("Contadores de telemetria")
+{
+    rbtree::Map<int, int> map;
+
+    for (int i = 0; i < 100; i++)
+        map.Insert(i, i);
+
+    for (int i = 0; i < 50; i++)
+        map.Remove(i);
+
+    CHECK(map.Contains(75));
+
+    rbtree::Telemetry telemetry = map.Stats().telemetry;
+
+#ifdef RBTREE_TELEMETRY
+    CHECK(telemetry.operations == 151);
+    CHECK(telemetry.allocations == 100);
+    CHECK(telemetry.deallocations == 50);
+    CHECK(telemetry.rotations > 0);
+    CHECK(telemetry.recolors > 0);
+    CHECK(telemetry.comparisons >= telemetry.operations);
+
+    map.ResetTelemetry();
+    CHECK(map.Stats().telemetry.operations == 0);
+
+    map.Clear();
+    CHECK(map.Stats().telemetry.deallocations == 50);
+#else
+    // The counters do not exist, so the snapshot is always zero
+    CHECK(telemetry.operations == 0);
+    CHECK(telemetry.comparisons == 0);
+    CHECK(telemetry.allocations == 0);
+#endif
+}
+
+TEST_CASE("Contadores de telemetria com operações paralelas")
+{
+    rbtree::RedBlackTree<int> tree1;
+    rbtree::RedBlackTree<int> tree2;
+
+    // tree1 has multiples of 2 and tree2 has multiples of 3
+    for (int i = 0; i < 60000; i += 2)
+        tree1.Insert(i);
+
+    for (int i = 0; i < 60000; i += 3)
+        tree2.Insert(i);
+
+    tree1.ResetTelemetry();
+    tree1.Union(tree2, 8);
+
+    CHECK(tree1.Size() == 40000);
+
+#ifdef RBTREE_TELEMETRY
+    // The multiples of 6 are freed by several threads at once, and none of the
+    // increments may be lost
+    CHECK(tree1.Stats().telemetry.deallocations == 10000);
+#else
+    CHECK(tree1.Stats().telemetry.deallocations == 0);
+#endif
+}
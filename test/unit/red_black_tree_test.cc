@@ -4,8 +4,14 @@
  * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
  */
 
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 #include "doctest.h"
 
+#include "reclaimer.h"
 #include "red_black_tree.h"
 
 TEST_CASE("Inserção")
@@ -89,6 +95,652 @@ TEST_CASE("Esvaziamento do tree")
     CHECK(tree.IsEmpty());
 }
 
+TEST_CASE("Remoção mantém o balanceamento")
+{
+    rbtree::RedBlackTree<int> tree;
+
+    for (int i = 0; i < 200; i++)
+        tree.Insert((i * 37) % 200);
+
+    for (int i = 0; i < 200; i += 3)
+    {
+        tree.Remove((i * 11) % 200);
+        CHECK(tree.IsRedBlackTreeBalanced());
+    }
+
+    CHECK(tree.Size() == 133);
+}
+
+TEST_CASE("Join e Split")
+{
+    rbtree::RedBlackTree<int> left;
+    rbtree::RedBlackTree<int> right;
+
+    for (int i = 0; i < 100; i++)
+        left.Insert(i);
+
+    for (int i = 100; i < 130; i++)
+        right.Insert(i);
+
+    left.Join(right);
+
+    CHECK(left.Size() == 130);
+    CHECK(right.IsEmpty());
+    CHECK(left.IsRedBlackTreeBalanced());
+
+    for (int i = 0; i < 130; i++)
+        CHECK(left.Search(i) != nullptr);
+
+    rbtree::RedBlackTree<int> other;
+    other.Insert(10);
+    CHECK_THROWS_AS(left.Join(other), std::invalid_argument);
+
+    SUBCASE("Split por uma chave presente")
+    {
+        left.Split(40, right);
+
+        CHECK(left.Size() == 40);
+        CHECK(right.Size() == 90);
+        CHECK(left.IsRedBlackTreeBalanced());
+        CHECK(right.IsRedBlackTreeBalanced());
+        CHECK(left.Search(40) == nullptr);
+        CHECK(right.Search(40) != nullptr);
+    }
+
+    SUBCASE("Split com o lado direito menor")
+    {
+        left.Split(120, right);
+
+        CHECK(left.Size() == 120);
+        CHECK(right.Size() == 10);
+        CHECK_NOTHROW(left.Validate());
+        CHECK_NOTHROW(right.Validate());
+    }
+
+    SUBCASE("Split por uma chave ausente")
+    {
+        left.Split(-5, right);
+
+        CHECK(left.IsEmpty());
+        CHECK(right.Size() == 130);
+    }
+}
+
+TEST_CASE("Union, Intersection e Difference")
+{
+    rbtree::RedBlackTree<int> tree1;
+    rbtree::RedBlackTree<int> tree2;
+
+    // tree1 has multiples of 2 and tree2 has multiples of 3
+    for (int i = 0; i < 600; i += 2)
+        tree1.Insert(i);
+
+    for (int i = 0; i < 600; i += 3)
+        tree2.Insert(i);
+
+    std::size_t numThreads = 1;
+
+    SUBCASE("Sequencial")
+    {
+        numThreads = 1;
+    }
+
+    SUBCASE("Paralelo")
+    {
+        numThreads = 4;
+    }
+
+    SUBCASE("Union")
+    {
+        tree1.Union(tree2, numThreads);
+
+        CHECK(tree2.IsEmpty());
+        CHECK(tree1.Size() == 400);
+        CHECK(tree1.IsRedBlackTreeBalanced());
+
+        for (int i = 0; i < 600; i++)
+            CHECK((tree1.Search(i) != nullptr) == (i % 2 == 0 or i % 3 == 0));
+    }
+
+    SUBCASE("Intersection")
+    {
+        tree1.Intersection(tree2, numThreads);
+
+        CHECK(tree2.IsEmpty());
+        CHECK(tree1.Size() == 100);
+        CHECK(tree1.IsRedBlackTreeBalanced());
+
+        for (int i = 0; i < 600; i++)
+            CHECK((tree1.Search(i) != nullptr) == (i % 6 == 0));
+    }
+
+    SUBCASE("Difference")
+    {
+        tree1.Difference(tree2, numThreads);
+
+        CHECK(tree2.IsEmpty());
+        CHECK(tree1.Size() == 200);
+        CHECK(tree1.IsRedBlackTreeBalanced());
+
+        for (int i = 0; i < 600; i++)
+            CHECK((tree1.Search(i) != nullptr) == (i % 2 == 0 and i % 3 != 0));
+    }
+}
+
+TEST_CASE("Inserção e busca em lote")
+{
+    rbtree::RedBlackTree<int> tree;
+    std::vector<int>          keys;
+
+    // Unsorted, with repeated keys
+    for (int i = 0; i < 1000; i++)
+        keys.push_back((i * 7919) % 500);
+
+    tree.InsertBatch(keys);
+
+    CHECK(tree.Size() == 500);
+    CHECK(tree.IsRedBlackTreeBalanced());
+
+    std::vector<int> queries;
+    for (int i = -10; i < 510; i++)
+        queries.push_back(i);
+
+    std::vector<rbtree::Node<int>*> nodes(queries.size());
+    bool                            found[520];
+
+    tree.SearchBatch(queries, nodes);
+    tree.ContainsBatch(queries, found);
+
+    for (std::size_t i = 0; i < queries.size(); i++)
+    {
+        bool expected = queries[i] >= 0 and queries[i] < 500;
+
+        CHECK(found[i] == expected);
+        CHECK((nodes[i] != nullptr) == expected);
+
+        if (nodes[i] != nullptr)
+            CHECK(nodes[i]->GetValue() == queries[i]);
+    }
+
+    CHECK_THROWS_AS(tree.ContainsBatch(queries, std::span<bool>(found, 10)),
+                    std::invalid_argument);
+}
+
+TEST_CASE("Inserção com dica e Append")
+{
+    rbtree::RedBlackTree<int> tree;
+
+    // Monotonic keys take the rightmost fast path
+    for (int i = 0; i < 1000; i += 2)
+        CHECK(tree.Append(i)->GetValue() == i);
+
+    CHECK(tree.Size() == 500);
+    CHECK(tree.IsRedBlackTreeBalanced());
+
+    // Keys smaller than the last one fall back to the usual insertion
+    CHECK(tree.Append(501)->GetValue() == 501);
+    CHECK(tree.Append(998) == tree.Search(998));
+
+    // Odd keys go right after their even neighbour
+    rbtree::Node<int>* hint = tree.Search(0);
+    for (int i = 1; i < 1000; i += 2)
+    {
+        hint = tree.Insert(hint, i);
+        CHECK(hint->GetValue() == i);
+    }
+
+    CHECK(tree.Size() == 1000);
+    CHECK(tree.IsRedBlackTreeBalanced());
+
+    // Before the hint, on an existing key and with a wrong hint
+    CHECK(tree.Insert(tree.Search(0), -1)->GetValue() == -1);
+    CHECK(tree.Insert(tree.Search(10), 9) == tree.Search(9));
+    CHECK(tree.Insert(tree.Search(10), 11) == tree.Search(11));
+    CHECK(tree.Insert(tree.Search(10), 2000)->GetValue() == 2000);
+    CHECK(tree.Insert(tree.Search(10), -5)->GetValue() == -5);
+    CHECK(tree.Insert(nullptr, 3000)->GetValue() == 3000);
+
+    CHECK(tree.Size() == 1004);
+    CHECK(tree.IsRedBlackTreeBalanced());
+
+    // The cached rightmost node follows removals, Split and Join
+    tree.Remove(3000);
+    tree.Remove(2000);
+    tree.Append(1500);
+    CHECK(tree.Search(1500) != nullptr);
+
+    rbtree::RedBlackTree<int> right;
+    tree.Split(500, right);
+    tree.Append(1600);
+
+    CHECK(tree.Search(1600) != nullptr);
+    CHECK(right.Search(1600) == nullptr);
+    CHECK(tree.IsRedBlackTreeBalanced());
+
+    tree.Remove(1600);
+    right.Append(1600);
+    tree.Join(right);
+    tree.Append(1700);
+
+    CHECK(tree.Size() == 1005);
+    CHECK(tree.IsRedBlackTreeBalanced());
+
+    for (int i = -1; i < 1000; i++)
+        CHECK(tree.Search(i) != nullptr);
+}
+
+TEST_CASE("Validação das invariantes")
+{
+    rbtree::RedBlackTree<int> tree;
+
+    CHECK_NOTHROW(tree.Validate());
+
+    for (int i = 0; i < 1000; i++)
+        tree.Insert((i * 7919) % 1000);
+
+    CHECK_NOTHROW(tree.Validate());
+
+    rbtree::Node<int>* root = tree.Search(500);
+    while (root->GetParent() != nullptr)
+        root = root->GetParent();
+
+    // Each corruption is detected and undone
+    root->SetColor(rbtree::RED);
+    CHECK_THROWS_AS(tree.Validate(), std::logic_error);
+    CHECK_THROWS_AS(tree.ValidateSample(), std::logic_error);
+    CHECK_FALSE(tree.IsRedBlackTreeBalanced());
+    root->SetColor(rbtree::BLACK);
+
+    rbtree::Node<int>* node = tree.Search(10);
+    node->GetValue()        = 2000;
+    CHECK_THROWS_AS(tree.Validate(), std::logic_error);
+    node->GetValue() = 10;
+
+    rbtree::Node<int>* parent = node->GetParent();
+    node->SetParent(nullptr);
+    CHECK_THROWS_AS(tree.Validate(), std::logic_error);
+    node->SetParent(parent);
+
+    // A black leaf painted red shortens the black height of its paths
+    rbtree::Node<int>* leaf = root;
+    while (leaf->GetLeftNode() != nullptr)
+        leaf = leaf->GetLeftNode();
+
+    rbtree::Color color = leaf->GetColor();
+    leaf->SetColor(color == rbtree::RED ? rbtree::BLACK : rbtree::RED);
+    CHECK_THROWS_AS(tree.Validate(), std::logic_error);
+    leaf->SetColor(color);
+
+    // Only a tree filled by InsertMulti may have equal keys
+    node->GetValue() = 11;
+    CHECK_THROWS_AS(tree.Validate(), std::logic_error);
+    node->GetValue() = 10;
+
+    rbtree::Node<int>* left  = root->GetLeftNode();
+    int                key   = left->GetValue();
+    bool               found = false;
+
+    // The sampled path visits the left child of the root half of the time
+    left->GetValue() = root->GetValue();
+
+    for (int i = 0; i < 64 and not found; i++)
+    {
+        try
+        {
+            tree.ValidateSample();
+        }
+        catch (const std::logic_error&)
+        {
+            found = true;
+        }
+    }
+
+    CHECK(found);
+    left->GetValue() = key;
+
+    CHECK_NOTHROW(tree.Validate());
+
+    // Sampled validation runs during the mutations
+    tree.SetValidationInterval(1);
+
+    for (int i = 0; i < 1000; i += 3)
+        CHECK_NOTHROW(tree.Remove(i));
+
+    for (int i = 1000; i < 2000; i++)
+        CHECK_NOTHROW(tree.Insert(i));
+
+    root = tree.Search(1500);
+    while (root->GetParent() != nullptr)
+        root = root->GetParent();
+
+    rbtree::Node<int>* child = root->GetLeftNode();
+    child->SetParent(nullptr);
+    CHECK_THROWS_AS(tree.Insert(5000), std::logic_error);
+    child->SetParent(root);
+
+    tree.SetValidationInterval(0);
+    CHECK_NOTHROW(tree.Validate());
+}
+
+TEST_CASE("Chaves repetidas com InsertMulti")
+{
+    rbtree::RedBlackTree<int> tree;
+
+    for (int copy = 0; copy < 5; copy++)
+        for (int i = 0; i < 100; i++)
+            tree.InsertMulti(i % 20);
+
+    CHECK(tree.Size() == 500);
+    CHECK_NOTHROW(tree.Validate());
+    CHECK(tree.Count(7) == 25);
+    CHECK(tree.Count(20) == 0);
+
+    auto range = tree.EqualRange(7);
+    int  seen  = 0;
+
+    for (rbtree::Node<int>* node = range.GetFirst(); node != range.GetSecond();
+         node                    = tree.Next(node))
+    {
+        CHECK(node->GetValue() == 7);
+        seen++;
+    }
+
+    CHECK(seen == 25);
+    CHECK(range.GetSecond()->GetValue() == 8);
+    CHECK(tree.EqualRange(19).GetSecond() == nullptr);
+
+    auto missing = tree.EqualRange(-1);
+    CHECK(missing.GetFirst() == missing.GetSecond());
+
+    // Remove deletes one copy and RemoveAll deletes the rest
+    tree.Remove(7);
+    CHECK(tree.Count(7) == 24);
+    CHECK(tree.RemoveAll(7) == 24);
+    CHECK(tree.Count(7) == 0);
+    CHECK(tree.RemoveAll(7) == 0);
+    CHECK(tree.Count(6) == 25);
+    CHECK(tree.Count(8) == 25);
+
+    CHECK(tree.Size() == 475);
+    CHECK_NOTHROW(tree.Validate());
+}
+
+TEST_CASE("Compactação dos nós")
+{
+    rbtree::RedBlackTree<int> tree;
+
+    for (int i = 0; i < 1000; i++)
+        tree.Insert((i * 7919) % 1000);
+
+    for (int i = 0; i < 1000; i += 3)
+        tree.Remove(i);
+
+    tree.Compact();
+    CHECK(tree.Size() == 666);
+    CHECK_NOTHROW(tree.Validate());
+
+    // The nodes follow each other in memory in key order
+    rbtree::Node<int>* node  = tree.Search(1);
+    int                count = 1;
+
+    for (rbtree::Node<int>* next = tree.Next(node); next != nullptr;
+         node = next, next = tree.Next(next), count++)
+    {
+        CHECK(node->GetValue() < next->GetValue());
+        CHECK(next == node + 1);
+    }
+
+    CHECK(count == 666);
+    CHECK(tree.CompactStep(10));
+
+    // Steps interleaved with insertions and removals
+    for (int i = 1000; i < 2000; i++)
+        tree.Insert(i);
+
+    std::size_t steps = 0;
+
+    while (not tree.CompactStep(50))
+    {
+        tree.Insert(5000 + static_cast<int>(steps));
+        tree.Remove(1000 + static_cast<int>(steps) * 7);
+        CHECK_NOTHROW(tree.Validate());
+        steps++;
+    }
+
+    CHECK(steps > 10);
+    CHECK_NOTHROW(tree.Validate());
+    CHECK(tree.Search(1001) != nullptr);
+    CHECK(tree.Search(1007) == nullptr);
+
+    // Trees that exchange compacted nodes keep releasing them correctly
+    rbtree::RedBlackTree<int> right;
+    rbtree::RedBlackTree<int> other;
+
+    tree.Split(1500, right);
+    right.Compact();
+
+    for (int i = 0; i < 3000; i += 2)
+        other.Insert(i);
+
+    other.Compact();
+    tree.Union(other);
+    tree.Remove(2);
+    right.Remove(1501);
+
+    CHECK(other.IsEmpty());
+    CHECK_NOTHROW(tree.Validate());
+    CHECK_NOTHROW(right.Validate());
+    CHECK(tree.Search(2998) != nullptr);
+
+    tree.Difference(right);
+    CHECK(tree.Search(1600) == nullptr);
+    CHECK_NOTHROW(tree.Validate());
+
+    tree.Clear();
+    CHECK(tree.CompactStep(1));
+}
+
+TEST_CASE("Remoção de nós de várias arenas")
+{
+    rbtree::RedBlackTree<int> tree;
+
+    // Each compacted tree brings its own arena, in no particular address order
+    for (int part = 7; part >= 0; part--)
+    {
+        rbtree::RedBlackTree<int> other;
+
+        for (int i = 0; i < 200; i++)
+            other.Insert(part * 1000 + i);
+
+        other.Compact();
+
+        if (part % 2 == 0)
+            other.Insert(part * 1000 + 500);
+
+        tree.Union(other);
+    }
+
+    CHECK(tree.Size() == 1604);
+
+    rbtree::RedBlackTree<int> right;
+    tree.Split(4000, right);
+    tree.Join(right);
+
+    for (int part = 0; part < 8; part++)
+        for (int i = 0; i < 200; i += 2)
+            tree.Remove(part * 1000 + i);
+
+    CHECK(tree.Size() == 804);
+    CHECK_NOTHROW(tree.Validate());
+
+    tree.Compact();
+    CHECK_NOTHROW(tree.Validate());
+
+    for (int part = 0; part < 8; part++)
+        CHECK(tree.RemoveAll(part * 1000 + 1) == 1);
+
+    CHECK(tree.Size() == 796);
+}
+
+TEST_CASE("Cópia, movimentação e Swap")
+{
+    rbtree::RedBlackTree<int> tree;
+
+    for (int i = 0; i < 300; i++)
+        tree.Insert((i * 37) % 300);
+
+    rbtree::RedBlackTree<int> copy(tree);
+
+    CHECK(copy.Size() == 300);
+    CHECK_NOTHROW(copy.Validate());
+    CHECK(copy.Stats().height == tree.Stats().height);
+
+    // The copies are independent and laid out in key order
+    tree.Remove(10);
+    copy.Insert(1000);
+
+    CHECK(tree.Search(10) == nullptr);
+    CHECK(copy.Search(10) != nullptr);
+    CHECK(tree.Search(1000) == nullptr);
+    CHECK(copy.Next(copy.Search(10)) == copy.Search(10) + 1);
+
+    copy = tree;
+    copy = copy;
+    CHECK(copy.Size() == 299);
+    CHECK_NOTHROW(copy.Validate());
+
+    rbtree::RedBlackTree<int> moved(std::move(copy));
+
+    CHECK(moved.Size() == 299);
+    CHECK(copy.IsEmpty());
+    copy.Insert(1);
+    CHECK(copy.Size() == 1);
+
+    rbtree::Node<int>* five = moved.Search(5);
+
+    moved.Swap(copy);
+    CHECK(copy.Search(5) == five);
+    CHECK(moved.Size() == 1);
+
+    moved = std::move(copy);
+    CHECK(moved.Size() == 299);
+    CHECK(copy.IsEmpty());
+    CHECK_NOTHROW(moved.Validate());
+
+    rbtree::RedBlackTree<int> empty;
+    rbtree::RedBlackTree<int> emptyCopy(empty);
+    CHECK(emptyCopy.IsEmpty());
+}
+
+// Key whose copy constructor throws after a given number of copies
+struct ThrowingKey
+{
+    int value;
+
+    static inline int live       = 0;
+    static inline int copiesLeft = -1;
+
+    ThrowingKey(int value)
+        : value(value)
+    {
+        live++;
+    }
+
+    ThrowingKey(const ThrowingKey& other)
+        : value(other.value)
+    {
+        if (copiesLeft == 0)
+            throw std::runtime_error("Copy failed");
+
+        if (copiesLeft > 0)
+            copiesLeft--;
+
+        live++;
+    }
+
+    ~ThrowingKey()
+    {
+        live--;
+    }
+
+    bool operator<(const ThrowingKey& other) const
+    {
+        return this->value < other.value;
+    }
+
+    bool operator==(const ThrowingKey& other) const
+    {
+        return this->value == other.value;
+    }
+};
+
+TEST_CASE("Cópia com exceção no construtor de cópia das chaves")
+{
+    rbtree::RedBlackTree<ThrowingKey> tree;
+
+    for (int i = 0; i < 100; i++)
+        tree.Insert(ThrowingKey((i * 37) % 100));
+
+    CHECK(ThrowingKey::live == 100);
+
+    // Fail at the first copy, in the middle and at the last one
+    for (int copies : { 0, 1, 50, 99 })
+    {
+        ThrowingKey::copiesLeft = copies;
+
+        CHECK_THROWS_AS((rbtree::RedBlackTree<ThrowingKey>(tree)), std::runtime_error);
+        CHECK(ThrowingKey::live == 100);
+    }
+
+    ThrowingKey::copiesLeft = -1;
+
+    rbtree::RedBlackTree<ThrowingKey> copy(tree);
+
+    CHECK(ThrowingKey::live == 200);
+    CHECK_NOTHROW(copy.Validate());
+}
+
+TEST_CASE("Esvaziamento incremental e em segundo plano")
+{
+    rbtree::RedBlackTree<int> tree;
+
+    for (int i = 0; i < 1000; i++)
+        tree.Insert(i);
+
+    tree.Compact();
+
+    // The first call detaches every element, the next ones free them
+    CHECK_FALSE(tree.ClearSome(100));
+    CHECK(tree.IsEmpty());
+
+    tree.Insert(5000);
+
+    std::size_t calls = 1;
+    while (not tree.ClearSome(100))
+        calls++;
+
+    CHECK(calls == 9);
+    CHECK(tree.Size() == 1);
+    CHECK(tree.Search(5000) != nullptr);
+    CHECK_NOTHROW(tree.Validate());
+
+    for (int i = 0; i < 1000; i++)
+        tree.Insert(i);
+
+    tree.ClearAsync();
+    CHECK(tree.IsEmpty());
+
+    tree.Insert(1);
+    CHECK(tree.Size() == 1);
+
+    // An unfinished teardown is completed by Clear
+    CHECK_FALSE(tree.ClearSome(0));
+    tree.Clear();
+    CHECK(tree.ClearSome(0));
+
+    utils::Reclaimer::Instance().Drain();
+}
+
 //TEST_CASE("Insertion and Removal")
 //{
 //    rbtree::RedBlackTree<int>        tree;
@@ -0,0 +1,250 @@
+/*
+ * Filename: timing_wheel_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "timing_wheel.h"
+
+TEST_CASE("Timing wheel: Agendar/Cancelar/Reagendar")
+{
+    utils::TimingWheel<int> wheel;
+    std::vector<int>        fired;
+
+    auto collect = [&fired](int& payload) { fired.push_back(payload); };
+
+    SUBCASE("Roda vazia")
+    {
+        CHECK(wheel.IsEmpty());
+        CHECK(wheel.Advance(1000, collect) == 0);
+        CHECK(wheel.Now() == 1000);
+        CHECK_FALSE(wheel.Cancel(0));
+        CHECK_FALSE(wheel.Contains(12345));
+    }
+
+    SUBCASE("Disparo em ordem de expiração")
+    {
+        wheel.Schedule(300, 3);
+        wheel.Schedule(5, 1);
+        wheel.Schedule(70000, 4);
+        wheel.Schedule(64, 2);
+
+        CHECK(wheel.Size() == 4);
+        CHECK(wheel.Advance(4, collect) == 0);
+        CHECK(wheel.Advance(300, collect) == 3);
+        CHECK(fired == std::vector<int> { 1, 2, 3 });
+
+        CHECK(wheel.Advance(69999, collect) == 0);
+        CHECK(wheel.Advance(70000, collect) == 1);
+        CHECK(fired.back() == 4);
+        CHECK(wheel.IsEmpty());
+    }
+
+    SUBCASE("Cancelar e reagendar")
+    {
+        utils::TimingWheel<int>::Handle a = wheel.Schedule(100, 1);
+        utils::TimingWheel<int>::Handle b = wheel.Schedule(200, 2);
+        utils::TimingWheel<int>::Handle c = wheel.Schedule(300, 3);
+
+        CHECK(wheel.Cancel(b));
+        CHECK_FALSE(wheel.Cancel(b));
+        CHECK_FALSE(wheel.Contains(b));
+
+        CHECK(wheel.Reschedule(c, 50));
+        CHECK(wheel.Reschedule(a, 5000));
+
+        wheel.Advance(1000, collect);
+        CHECK(fired == std::vector<int> { 3 });
+        CHECK_FALSE(wheel.Reschedule(c, 2000));
+        CHECK(wheel.Contains(a));
+
+        // The pool entry of 'b' is reused, but the old handle stays stale
+        utils::TimingWheel<int>::Handle d = wheel.Schedule(1500, 4);
+        CHECK(d != b);
+        CHECK_FALSE(wheel.Cancel(b));
+
+        wheel.Advance(6000, collect);
+        CHECK(fired == std::vector<int> { 3, 4, 1 });
+    }
+
+    SUBCASE("Temporizador vencido e agendamento dentro do disparo")
+    {
+        wheel.Advance(500, collect);
+        wheel.Schedule(10, 1);
+
+        utils::TimingWheel<int>::Handle later = wheel.Schedule(503, 3);
+
+        std::size_t count = wheel.Advance(510, [&](int& payload) {
+            fired.push_back(payload);
+
+            if (payload == 1)
+            {
+                wheel.Schedule(502, 2);
+                wheel.Cancel(later);
+            }
+        });
+
+        CHECK(count == 2);
+        CHECK(fired == std::vector<int> { 1, 2 });
+    }
+
+    SUBCASE("Cancelar e reagendar no mesmo tick dentro do disparo")
+    {
+        std::vector<utils::TimingWheel<int>::Handle> handles;
+
+        for (int payload : { 1, 2, 3 })
+            handles.push_back(wheel.Schedule(600, payload));
+
+        // The first callback cancels one of the other timers due on the same tick
+        // and moves the last one to a later tick
+        std::size_t count = wheel.Advance(600, [&](int& payload) {
+            fired.push_back(payload);
+
+            if (fired.size() > 1)
+                return;
+
+            std::vector<utils::TimingWheel<int>::Handle> pending;
+
+            for (utils::TimingWheel<int>::Handle handle : handles)
+                if (wheel.Contains(handle))
+                    pending.push_back(handle);
+
+            REQUIRE(pending.size() == 2);
+            CHECK(wheel.Cancel(pending[0]));
+            CHECK(wheel.Reschedule(pending[1], 700));
+        });
+
+        CHECK(count == 1);
+        CHECK(wheel.Size() == 1);
+        CHECK(wheel.Advance(700, collect) == 1);
+        CHECK(fired.size() == 2);
+    }
+
+    SUBCASE("Expiração no início de uma volta")
+    {
+        // Each timer reaches level 0 by a cascade at the very tick it expires
+        wheel.Schedule(64, 1);
+        wheel.Schedule(4096, 2);
+        wheel.Schedule(262144, 3);
+
+        CHECK(wheel.Advance(64, collect) == 1);
+        CHECK(wheel.Advance(4096, collect) == 1);
+        CHECK(wheel.Advance(262144, collect) == 1);
+        CHECK(fired == std::vector<int> { 1, 2, 3 });
+    }
+
+    SUBCASE("Além do alcance da roda")
+    {
+        std::uint64_t far = std::uint64_t(1) << 40;
+
+        wheel.Schedule(far, 1);
+        wheel.Advance(far - 1, collect);
+        CHECK(fired.empty());
+
+        wheel.Advance(far, collect);
+        CHECK(fired == std::vector<int> { 1 });
+    }
+
+    SUBCASE("Limpar")
+    {
+        utils::TimingWheel<int>::Handle a = wheel.Schedule(10, 1);
+        wheel.Schedule(100000, 2);
+        wheel.Clear();
+
+        CHECK(wheel.IsEmpty());
+        CHECK_FALSE(wheel.Contains(a));
+        CHECK(wheel.Advance(200000, collect) == 0);
+    }
+}
+
+TEST_CASE("Timing wheel: Carga aleatória")
+{
+    // Every pending timer is mirrored in a map from payload to the tick at which it
+    // must fire, which is its expiry or, if that is already past, the next tick
+    using Handle = utils::TimingWheel<int>::Handle;
+
+    std::mt19937_64              random(42);
+    utils::TimingWheel<int>      wheel(1000);
+    std::map<int, std::uint64_t> expected;
+    std::map<int, Handle>        handles;
+    int                          next    = 0;
+    const std::uint64_t          spans[] = { 64, 5000, 300000, 50000000 };
+
+    for (int step = 0; step < 20000; step++)
+    {
+        std::uint64_t now    = wheel.Now();
+        std::uint64_t expiry = now + random() % spans[random() % 4];
+        std::uint64_t due    = std::max(expiry, now + 1);
+
+        switch (random() % 4)
+        {
+            case 0:
+            case 1:
+                handles[next]  = wheel.Schedule(expiry, next);
+                expected[next] = due;
+                next++;
+                break;
+
+            case 2:
+            {
+                if (handles.empty())
+                    break;
+
+                auto it = handles.lower_bound(static_cast<int>(random() % next));
+
+                if (it == handles.end())
+                    it = handles.begin();
+
+                if (random() % 2 == 0)
+                {
+                    REQUIRE(wheel.Reschedule(it->second, expiry));
+                    expected[it->first] = due;
+                }
+                else
+                {
+                    REQUIRE(wheel.Cancel(it->second));
+                    REQUIRE_FALSE(wheel.Contains(it->second));
+                    expected.erase(it->first);
+                    handles.erase(it);
+                }
+                break;
+            }
+
+            case 3:
+            {
+                std::uint64_t target = now + random() % spans[random() % 3];
+                std::uint64_t last   = 0;
+                std::size_t   count  = 0;
+
+                for (const auto& [payload, tick] : expected)
+                    count += tick <= target;
+
+                CHECK(wheel.Advance(target, [&](int& payload) {
+                    REQUIRE(expected.count(payload) == 1);
+
+                    std::uint64_t tick = expected[payload];
+
+                    CHECK(tick <= target);
+                    CHECK(tick >= last);
+
+                    last = tick;
+                    expected.erase(payload);
+                    handles.erase(payload);
+                }) == count);
+
+                CHECK(wheel.Now() == target);
+                break;
+            }
+        }
+
+        REQUIRE(wheel.Size() == expected.size());
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Filename: top_k_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "top_k.h"
+
+TEST_CASE("TopK: Oferta de elementos um a um")
+{
+    bheap::TopK<int, decltype(comparators::Greater<int>)> top(3);
+
+    CHECK(top.IsEmpty());
+    CHECK_THROWS_AS(top.Threshold(), std::overflow_error);
+    CHECK_THROWS_AS(bheap::TopK<int>(0), std::invalid_argument);
+
+    CHECK(top.Offer(5));
+    CHECK(top.Offer(1));
+    CHECK(top.Offer(9));
+    CHECK(top.IsFull());
+    CHECK(top.Threshold() == 1);
+
+    // Not better than the threshold, ties included
+    CHECK_FALSE(top.Offer(0));
+    CHECK_FALSE(top.Offer(1));
+
+    CHECK(top.Offer(7));
+    CHECK(top.Threshold() == 5);
+    CHECK(top.Size() == 3);
+    CHECK(top.Capacity() == 3);
+
+    Vector<int> sorted = top.Sorted();
+
+    CHECK(sorted.Size() == 3);
+    CHECK(sorted[0] == 9);
+    CHECK(sorted[1] == 7);
+    CHECK(sorted[2] == 5);
+
+    top.Clear();
+    CHECK(top.IsEmpty());
+}
+
+TEST_CASE("TopK: Lotes, elementos não triviais e modo paralelo")
+{
+    std::mt19937     generator(9);
+    std::vector<int> values;
+
+    for (int i = 0; i < 100000; i++)
+        values.push_back(static_cast<int>(generator() % 1000000));
+
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    for (std::size_t k : { 1, 10, 1000 })
+    {
+        bheap::TopK<int> batch(k);
+        batch.Offer(values);
+
+        bheap::TopK<int> parallel = bheap::TopK<int>::Parallel(values, k, 4);
+
+        Vector<int> batchSorted    = batch.Sorted();
+        Vector<int> parallelSorted = parallel.Sorted();
+
+        REQUIRE(batchSorted.Size() == k);
+        REQUIRE(parallelSorted.Size() == k);
+
+        for (std::size_t i = 0; i < k; i++)
+        {
+            CHECK(batchSorted[i] == expected[i]);
+            CHECK(parallelSorted[i] == expected[i]);
+        }
+    }
+
+    SUBCASE("Menos elementos que K")
+    {
+        bheap::TopK<int> top(10);
+        top.Offer(std::span<const int>(values.data(), 4));
+
+        CHECK(top.Size() == 4);
+        CHECK_FALSE(top.IsFull());
+    }
+
+    SUBCASE("Strings")
+    {
+        std::vector<std::string> words = { "pera", "uva", "banana", "abacaxi" };
+
+        bheap::TopK<std::string> top(2);
+        top.Offer(words);
+
+        Vector<std::string> sorted = top.Sorted();
+
+        CHECK(sorted[0] == "abacaxi");
+        CHECK(sorted[1] == "banana");
+    }
+}